@@ -17,6 +17,7 @@
 #include <drivers/auth/auth_mod.h>
 #include <drivers/auth/crypto_mod.h>
 #include <drivers/console.h>
+#include <lib/boot_timing.h>
 #include <lib/cpus/errata_report.h>
 #include <lib/utils.h>
 #include <plat/common/platform.h>
@@ -57,12 +58,16 @@ void bl1_calc_bl2_mem_layout(const meminfo_t *bl1_mem_layout,
  ******************************************************************************/
 void bl1_setup(void)
 {
+	BOOT_TIMING_RECORD(BOOT_TIMING_EV_STAGE_ENTRY, INVALID_IMAGE_ID);
+
 	/* Perform early platform-specific setup */
 	bl1_early_platform_setup();
 
 	/* Perform late platform-specific setup */
 	bl1_plat_arch_setup();
 
+	BOOT_TIMING_RECORD(BOOT_TIMING_EV_MMU_ENABLED, INVALID_IMAGE_ID);
+
 #if CTX_INCLUDE_PAUTH_REGS
 	/*
 	 * Assert that the ARMv8.3-PAuth registers are present or an access
@@ -154,6 +159,8 @@ void bl1_main(void)
 	/* Teardown the measured boot driver */
 	bl1_plat_mboot_finish();
 
+	BOOT_TIMING_RECORD(BOOT_TIMING_EV_HANDOFF, image_id);
+
 	bl1_prepare_next_image(image_id);
 
 	console_flush();
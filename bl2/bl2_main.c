@@ -16,6 +16,7 @@
 #include <drivers/auth/crypto_mod.h>
 #include <drivers/console.h>
 #include <drivers/fwu/fwu.h>
+#include <lib/boot_timing.h>
 #include <lib/extensions/pauth.h>
 #include <plat/common/platform.h>
 
@@ -34,12 +35,16 @@
 void bl2_el3_setup(u_register_t arg0, u_register_t arg1, u_register_t arg2,
 		   u_register_t arg3)
 {
+	BOOT_TIMING_RECORD(BOOT_TIMING_EV_STAGE_ENTRY, INVALID_IMAGE_ID);
+
 	/* Perform early platform-specific setup */
 	bl2_el3_early_platform_setup(arg0, arg1, arg2, arg3);
 
 	/* Perform late platform-specific setup */
 	bl2_el3_plat_arch_setup();
 
+	BOOT_TIMING_RECORD(BOOT_TIMING_EV_MMU_ENABLED, INVALID_IMAGE_ID);
+
 #if CTX_INCLUDE_PAUTH_REGS
 	/*
 	 * Assert that the ARMv8.3-PAuth registers are present or an access
@@ -56,12 +61,16 @@ void bl2_el3_setup(u_register_t arg0, u_register_t arg1, u_register_t arg2,
 void bl2_setup(u_register_t arg0, u_register_t arg1, u_register_t arg2,
 	       u_register_t arg3)
 {
+	BOOT_TIMING_RECORD(BOOT_TIMING_EV_STAGE_ENTRY, INVALID_IMAGE_ID);
+
 	/* Perform early platform-specific setup */
 	bl2_early_platform_setup2(arg0, arg1, arg2, arg3);
 
 	/* Perform late platform-specific setup */
 	bl2_plat_arch_setup();
 
+	BOOT_TIMING_RECORD(BOOT_TIMING_EV_MMU_ENABLED, INVALID_IMAGE_ID);
+
 #if CTX_INCLUDE_PAUTH_REGS
 	/*
 	 * Assert that the ARMv8.3-PAuth registers are present or an access
@@ -108,6 +117,8 @@ void bl2_main(void)
 	/* Teardown the Measured Boot backend */
 	bl2_plat_mboot_finish();
 
+	BOOT_TIMING_RECORD(BOOT_TIMING_EV_HANDOFF, INVALID_IMAGE_ID);
+
 #if !BL2_RUNS_AT_EL3
 #ifndef __aarch64__
 	/*
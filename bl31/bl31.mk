@@ -62,6 +62,30 @@ ifeq (${ENABLE_PMF}, 1)
 BL31_SOURCES		+=	lib/pmf/pmf_main.c
 endif
 
+ifeq (${ENABLE_SMC_STATS},1)
+BL31_SOURCES		+=	bl31/smc_stats.c
+endif
+
+ifeq (${ENABLE_LOCK_STATS},1)
+BL31_SOURCES		+=	lib/locks/stats/lock_stats.c			\
+				lib/locks/stats/lock_stats_smc.c
+endif
+
+ifeq (${ENABLE_LOCK_BENCH},1)
+BL31_SOURCES		+=	lib/locks/bench/lock_bench.c
+endif
+
+ifeq (${ENABLE_BOOT_TIMING},1)
+BL31_SOURCES		+=	lib/boot_timing/boot_timing_smc.c
+endif
+
+ifeq (${ENABLE_EL3_TRACE},1)
+BL31_SOURCES		+=	lib/el3_trace/el3_trace.c			\
+				lib/el3_trace/el3_trace_smc.c
+# The trace buffer is mapped at runtime
+BL31_CPPFLAGS		+=	-DPLAT_XLAT_TABLES_DYNAMIC
+endif
+
 include lib/debugfs/debugfs.mk
 ifeq (${USE_DEBUGFS},1)
 	BL31_SOURCES	+= $(DEBUGFS_SRCS)
@@ -69,6 +93,9 @@ endif
 
 ifeq (${EL3_EXCEPTION_HANDLING},1)
 BL31_SOURCES		+=	bl31/ehf.c
+ifeq (${ENABLE_EHF_STATS},1)
+BL31_SOURCES		+=	bl31/ehf_stats.c
+endif
 endif
 
 ifeq (${SDEI_SUPPORT},1)
@@ -87,6 +114,18 @@ BL31_SOURCES		+=	services/std_svc/trng/trng_main.c	\
 				services/std_svc/trng/trng_entropy_pool.c
 endif
 
+ifeq (${RAS_ERROR_LOG},1)
+BL31_SOURCES		+=	lib/extensions/ras/ras_log.c
+endif
+
+ifeq (${TRNG_DRBG_SUPPORT},1)
+ifneq (${TRNG_SUPPORT},1)
+  $(error TRNG_SUPPORT must be 1 for TRNG_DRBG_SUPPORT)
+endif
+include drivers/auth/mbedtls/mbedtls_common.mk
+BL31_SOURCES		+=	services/std_svc/trng/trng_drbg.c
+endif
+
 ifneq (${ENABLE_SPE_FOR_NS},0)
 BL31_SOURCES		+=	lib/extensions/spe/spe.c
 endif
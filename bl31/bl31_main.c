@@ -17,6 +17,7 @@
 #include <common/feat_detect.h>
 #include <common/runtime_svc.h>
 #include <drivers/console.h>
+#include <lib/boot_timing.h>
 #include <lib/el3_runtime/context_mgmt.h>
 #include <lib/pmf/pmf.h>
 #include <lib/runtime_instr.h>
@@ -87,12 +88,16 @@ void __init bl31_lib_init(void)
 void bl31_setup(u_register_t arg0, u_register_t arg1, u_register_t arg2,
 		u_register_t arg3)
 {
+	BOOT_TIMING_RECORD(BOOT_TIMING_EV_STAGE_ENTRY, INVALID_IMAGE_ID);
+
 	/* Perform early platform-specific setup */
 	bl31_early_platform_setup2(arg0, arg1, arg2, arg3);
 
 	/* Perform late platform-specific setup */
 	bl31_plat_arch_setup();
 
+	BOOT_TIMING_RECORD(BOOT_TIMING_EV_MMU_ENABLED, INVALID_IMAGE_ID);
+
 #if CTX_INCLUDE_PAUTH_REGS
 	/*
 	 * Assert that the ARMv8.3-PAuth registers are present or an access
@@ -187,6 +192,8 @@ void bl31_main(void)
 	 * We are ready to enter the next EL. Prepare entry into the image
 	 * corresponding to the desired security state after the next ERET.
 	 */
+	BOOT_TIMING_RECORD(BOOT_TIMING_EV_HANDOFF, INVALID_IMAGE_ID);
+
 	bl31_prepare_next_image_entry();
 
 	console_flush();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -12,6 +12,7 @@
 #include <stdbool.h>
 
 #include <bl31/ehf.h>
+#include <bl31/ehf_stats.h>
 #include <bl31/interrupt_mgmt.h>
 #include <context.h>
 #include <common/debug.h>
@@ -19,6 +20,7 @@
 #include <lib/el3_runtime/context_mgmt.h>
 #include <lib/el3_runtime/cpu_data.h>
 #include <lib/el3_runtime/pubsub_events.h>
+#include <lib/el3_trace.h>
 #include <plat/common/platform.h>
 
 /* Output EHF logs as verbose */
@@ -150,6 +152,9 @@ void ehf_activate_priority(unsigned int priority)
 	if (cur_pri_idx == EHF_INVALID_IDX)
 		pe_data->init_pri_mask = (uint8_t) old_mask;
 
+	EL3_TRACE(EL3_TRACE_EV_EHF_ACTIVATE, priority, old_mask, 0U);
+	ehf_stats_activate(idx);
+
 	EHF_LOG("activate prio=%d\n", get_pe_highest_active_idx(pe_data));
 }
 
@@ -214,6 +219,9 @@ void ehf_deactivate_priority(unsigned int priority)
 		panic();
 	}
 
+	EL3_TRACE(EL3_TRACE_EV_EHF_DEACTIVATE, priority, old_mask, 0U);
+	ehf_stats_deactivate(idx);
+
 	EHF_LOG("deactivate prio=%d\n", get_pe_highest_active_idx(pe_data));
 }
 
@@ -254,6 +262,8 @@ static void *ehf_exited_normal_world(const void *arg)
 		panic();
 	}
 
+	ehf_stats_ns_masked();
+
 	EHF_LOG("Priority Mask: 0x%x => 0x%x\n", pe_data->ns_pri_mask,
 			GIC_HIGHEST_NS_PRIORITY);
 
@@ -305,6 +315,8 @@ static void *ehf_entering_normal_world(const void *arg)
 		panic();
 	}
 
+	ehf_stats_ns_unmasked();
+
 	EHF_LOG("Priority Mask: 0x%x => 0x%x\n", old_pmr, pe_data->ns_pri_mask);
 
 	pe_data->ns_pri_mask = 0;
@@ -352,6 +364,7 @@ void ehf_allow_ns_preemption(uint64_t preempt_ret_code)
 	write_ctx_reg(get_gpregs_ctx(ns_ctx), CTX_GPREG_X0, preempt_ret_code);
 
 	old_pmr = plat_ic_set_priority_mask(pe_data->ns_pri_mask);
+	ehf_stats_ns_unmasked();
 
 	EHF_LOG("Priority Mask: 0x%x => 0x%x\n", old_pmr, pe_data->ns_pri_mask);
 
@@ -444,7 +457,9 @@ static uint64_t ehf_el3_interrupt_handler(uint32_t id, uint32_t flags,
 	 * Call registered handler. Pass the raw interrupt value to registered
 	 * handlers.
 	 */
+	ehf_stats_intr_enter(idx);
 	ret = handler(intr_raw, flags, handle, cookie);
+	ehf_stats_intr_exit(idx);
 
 	return (uint64_t) ret;
 }
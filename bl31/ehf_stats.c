@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Usage statistics of the EL3 exception priority levels managed by the EHF.
+ */
+
+#include <arch_helpers.h>
+#include <bl31/ehf.h>
+#include <bl31/ehf_stats.h>
+#include <lib/utils.h>
+#include <plat/common/platform.h>
+#include <smccc_helpers.h>
+
+/*
+ * Number of priority levels, starting from the highest, for which statistics
+ * are kept. Platforms using few priority bits can reduce it to save memory.
+ */
+#ifdef PLAT_EHF_STATS_MAX_PRIORITIES
+#define EHF_STATS_PRIORITIES		PLAT_EHF_STATS_MAX_PRIORITIES
+#else
+#define EHF_STATS_PRIORITIES		EHF_STATS_MAX_PRIORITIES
+#endif
+
+/* Per-CPU statistics */
+typedef struct ehf_stats_cpu {
+	ehf_stats_pri_t pri[EHF_STATS_PRIORITIES];
+
+	/* Counter value on the last entry into EL3 for an interrupt */
+	uint64_t entry_ts;
+
+	/* Current and maximum number of nested active priority levels */
+	unsigned int depth;
+	unsigned int max_depth;
+
+	/* Time spent in Secure execution with Non-secure interrupts masked */
+	uint64_t ns_masked_start;
+	uint64_t ns_masked_total;
+	uint64_t ns_masked_max;
+} ehf_stats_cpu_t;
+
+/* To be defined by the platform */
+extern const ehf_priorities_t exception_data;
+
+/*
+ * Each CPU only updates its own statistics, so no locking is required. Readers
+ * on other CPUs may observe partially updated values.
+ */
+static ehf_stats_cpu_t ehf_stats[PLATFORM_CORE_COUNT];
+
+static ehf_stats_cpu_t *ehf_stats_this_cpu(void)
+{
+	return &ehf_stats[plat_my_core_pos()];
+}
+
+static void ehf_stats_level_enter(ehf_stats_cpu_t *stats, unsigned int idx,
+				  uint64_t now)
+{
+	stats->pri[idx].start = now;
+
+	stats->depth++;
+	if (stats->depth > stats->max_depth) {
+		stats->max_depth = stats->depth;
+	}
+}
+
+static void ehf_stats_level_exit(ehf_stats_cpu_t *stats, unsigned int idx)
+{
+	ehf_stats_pri_t *pri = &stats->pri[idx];
+	uint64_t ticks;
+
+	/* Ignore levels entered before the statistics were reset */
+	if ((pri->start == 0ULL) || (stats->depth == 0U)) {
+		return;
+	}
+
+	ticks = read_cntpct_el0() - pri->start;
+	pri->start = 0ULL;
+	pri->total += ticks;
+	if (ticks > pri->max) {
+		pri->max = ticks;
+	}
+
+	stats->depth--;
+}
+
+/*
+ * Record the entry of this CPU into EL3 for an interrupt. Called from the
+ * interrupt exception vectors in runtime_exceptions.S, once the context of the
+ * interrupted world has been saved.
+ */
+void ehf_stats_record_entry(void)
+{
+	ehf_stats_this_cpu()->entry_ts = read_cntpct_el0();
+}
+
+/* An EL3 interrupt at priority level 'idx' is about to be handled */
+void ehf_stats_intr_enter(unsigned int idx)
+{
+	ehf_stats_cpu_t *stats = ehf_stats_this_cpu();
+	ehf_stats_pri_t *pri;
+	uint64_t now, latency;
+
+	if (idx >= EHF_STATS_PRIORITIES) {
+		return;
+	}
+
+	now = read_cntpct_el0();
+	pri = &stats->pri[idx];
+	pri->interrupts++;
+
+	if (stats->entry_ts != 0ULL) {
+		latency = now - stats->entry_ts;
+		stats->entry_ts = 0ULL;
+
+		pri->latency_total += latency;
+		if (latency > pri->latency_max) {
+			pri->latency_max = latency;
+		}
+	}
+
+	ehf_stats_level_enter(stats, idx, now);
+}
+
+/* The handler of an EL3 interrupt at priority level 'idx' has returned */
+void ehf_stats_intr_exit(unsigned int idx)
+{
+	if (idx < EHF_STATS_PRIORITIES) {
+		ehf_stats_level_exit(ehf_stats_this_cpu(), idx);
+	}
+}
+
+/* Priority level 'idx' has been explicitly activated */
+void ehf_stats_activate(unsigned int idx)
+{
+	ehf_stats_cpu_t *stats = ehf_stats_this_cpu();
+
+	if (idx < EHF_STATS_PRIORITIES) {
+		stats->pri[idx].activations++;
+		ehf_stats_level_enter(stats, idx, read_cntpct_el0());
+	}
+}
+
+/* Priority level 'idx' has been explicitly deactivated */
+void ehf_stats_deactivate(unsigned int idx)
+{
+	if (idx < EHF_STATS_PRIORITIES) {
+		ehf_stats_level_exit(ehf_stats_this_cpu(), idx);
+	}
+}
+
+/* Non-secure interrupts have been masked on leaving the Non-secure world */
+void ehf_stats_ns_masked(void)
+{
+	ehf_stats_this_cpu()->ns_masked_start = read_cntpct_el0();
+}
+
+/*
+ * Non-secure interrupts have been unmasked, either on return to the Non-secure
+ * world or because Secure execution allowed them to preempt it.
+ */
+void ehf_stats_ns_unmasked(void)
+{
+	ehf_stats_cpu_t *stats = ehf_stats_this_cpu();
+	uint64_t ticks;
+
+	if (stats->ns_masked_start == 0ULL) {
+		return;
+	}
+
+	ticks = read_cntpct_el0() - stats->ns_masked_start;
+	stats->ns_masked_start = 0ULL;
+	stats->ns_masked_total += ticks;
+	if (ticks > stats->ns_masked_max) {
+		stats->ns_masked_max = ticks;
+	}
+}
+
+/*
+ * This function is responsible for handling all EHF statistics SMC calls from
+ * the Non-secure world.
+ */
+uintptr_t ehf_stats_smc_handler(unsigned int smc_fid,
+				u_register_t x1,
+				u_register_t x2,
+				u_register_t x3,
+				u_register_t x4,
+				void *cookie,
+				void *handle,
+				u_register_t flags)
+{
+	const ehf_stats_cpu_t *stats;
+	const ehf_stats_pri_t *pri;
+	unsigned int pri_bits = exception_data.pri_bits;
+	unsigned int num_pri;
+
+	switch (smc_fid) {
+	case EHF_STATS_SMC_GET_INFO:
+		/*
+		 * x1 <-- CPU index.
+		 * x0 --> error code.
+		 * x1 --> number of CPUs.
+		 * x2 --> number of priority levels with statistics.
+		 * x3 --> maximum number of nested active priority levels.
+		 * x4 --> total time with Non-secure interrupts masked.
+		 * x5 --> longest time with Non-secure interrupts masked.
+		 */
+		if (x1 >= PLATFORM_CORE_COUNT) {
+			SMC_RET1(handle, EHF_STATS_E_INVALID_PARAMS);
+		}
+
+		stats = &ehf_stats[x1];
+		num_pri = MIN((unsigned int)exception_data.num_priorities,
+			      (unsigned int)EHF_STATS_PRIORITIES);
+		SMC_RET6(handle, EHF_STATS_E_SUCCESS, PLATFORM_CORE_COUNT,
+			 num_pri, stats->max_depth, stats->ns_masked_total,
+			 stats->ns_masked_max);
+
+	case EHF_STATS_SMC_GET_PRI:
+		/*
+		 * x1 <-- CPU index.
+		 * x2 <-- priority level index, 0 being the highest priority.
+		 * x0 --> error code.
+		 * x1 --> GIC priority of the level.
+		 * x2 --> number of interrupts handled.
+		 * x3 --> number of explicit activations.
+		 * x4 --> total time spent at the level.
+		 * x5 --> longest time spent at the level.
+		 * x6 --> total interrupt handling latency.
+		 * x7 --> maximum interrupt handling latency.
+		 */
+		if ((x1 >= PLATFORM_CORE_COUNT) ||
+		    (x2 >= exception_data.num_priorities) ||
+		    (x2 >= EHF_STATS_PRIORITIES)) {
+			SMC_RET1(handle, EHF_STATS_E_INVALID_PARAMS);
+		}
+
+		pri = &ehf_stats[x1].pri[x2];
+		SMC_RET8(handle, EHF_STATS_E_SUCCESS,
+			 (x2 << (7U - pri_bits)) & 0x7fU, pri->interrupts,
+			 pri->activations, pri->total, pri->max,
+			 pri->latency_total, pri->latency_max);
+
+	case EHF_STATS_SMC_RESET:
+		/*
+		 * Samples recorded concurrently on other CPUs may be partially
+		 * lost.
+		 */
+		zeromem(ehf_stats, sizeof(ehf_stats));
+		SMC_RET1(handle, EHF_STATS_E_SUCCESS);
+
+	default:
+		break;
+	}
+
+	SMC_RET1(handle, SMC_UNK);
+}
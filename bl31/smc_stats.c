@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+
+#include <arch_helpers.h>
+#include <bl31/smc_stats.h>
+#include <common/debug.h>
+#include <lib/cassert.h>
+#include <lib/utils.h>
+#include <plat/common/platform.h>
+#include <smccc_helpers.h>
+
+CASSERT(IS_POWER_OF_TWO(SMC_STATS_MAX_FIDS),
+	assert_smc_stats_max_fids_not_power_of_two);
+
+/* The histogram is returned in six registers by SMC_STATS_SMC_GET_HIST */
+CASSERT(SMC_STATS_HIST_BUCKETS == 12U, assert_smc_stats_hist_buckets_mismatch);
+
+/*
+ * Per-CPU open addressing hash tables of SMC function IDs. Each table is only
+ * written by the CPU it belongs to, from the SMC exit path, so no locking is
+ * required. Readers on other CPUs may observe partially updated entries.
+ */
+static smc_stats_entry_t smc_stats[PLATFORM_CORE_COUNT][SMC_STATS_MAX_FIDS];
+
+/* Number of samples dropped because a per-CPU table was full */
+static uint64_t smc_stats_dropped[PLATFORM_CORE_COUNT];
+
+static unsigned int smc_stats_hash(uint32_t smc_fid)
+{
+	/* Fibonacci hashing, the top bits of the product are the most mixed */
+	return (unsigned int)((smc_fid * 0x9E3779B1U) >> 16) &
+	       (SMC_STATS_MAX_FIDS - 1U);
+}
+
+static unsigned int smc_stats_hist_bucket(uint64_t ticks)
+{
+	unsigned int bucket;
+
+	if (ticks == 0ULL) {
+		return 0U;
+	}
+
+	bucket = (63U - (unsigned int)__builtin_clzll(ticks)) /
+		 SMC_STATS_HIST_LOG2_WIDTH;
+
+	return (bucket < SMC_STATS_HIST_BUCKETS) ?
+		bucket : (SMC_STATS_HIST_BUCKETS - 1U);
+}
+
+/*
+ * Account for one SMC handled by this CPU. Called from the SMC dispatcher in
+ * runtime_exceptions.S once the handler returns, with the function ID and the
+ * system counter value read on entry to EL3.
+ */
+void smc_stats_record(uint32_t smc_fid, uint64_t entry_ts)
+{
+	unsigned int cpu = plat_my_core_pos();
+	unsigned int idx = smc_stats_hash(smc_fid);
+	unsigned int i;
+	uint64_t ticks = read_cntpct_el0() - entry_ts;
+	smc_stats_entry_t *entry;
+
+	for (i = 0U; i < SMC_STATS_MAX_FIDS; i++) {
+		entry = &smc_stats[cpu][idx];
+
+		if (entry->count == 0ULL) {
+			entry->smc_fid = smc_fid;
+			entry->min = ticks;
+			break;
+		}
+
+		if (entry->smc_fid == smc_fid) {
+			break;
+		}
+
+		idx = (idx + 1U) & (SMC_STATS_MAX_FIDS - 1U);
+	}
+
+	if (i == SMC_STATS_MAX_FIDS) {
+		smc_stats_dropped[cpu]++;
+		return;
+	}
+
+	entry->count++;
+	entry->total += ticks;
+	if (ticks < entry->min) {
+		entry->min = ticks;
+	}
+	if (ticks > entry->max) {
+		entry->max = ticks;
+	}
+	entry->hist[smc_stats_hist_bucket(ticks)]++;
+}
+
+/*
+ * Return the entry at position 'idx' of the table of CPU 'cpu_idx', or NULL if
+ * the position is out of range. The returned entry may be unused.
+ */
+const smc_stats_entry_t *smc_stats_get(unsigned int cpu_idx, unsigned int idx)
+{
+	if ((cpu_idx >= PLATFORM_CORE_COUNT) || (idx >= SMC_STATS_MAX_FIDS)) {
+		return NULL;
+	}
+
+	return &smc_stats[cpu_idx][idx];
+}
+
+/*
+ * Clear the statistics of all CPUs. Samples recorded concurrently on other
+ * CPUs may be partially lost.
+ */
+void smc_stats_reset(void)
+{
+	zeromem(smc_stats, sizeof(smc_stats));
+	zeromem(smc_stats_dropped, sizeof(smc_stats_dropped));
+}
+
+/*
+ * This function is responsible for handling all SMC statistics SMC calls from
+ * the Non-secure world.
+ */
+uintptr_t smc_stats_smc_handler(unsigned int smc_fid,
+				u_register_t x1,
+				u_register_t x2,
+				u_register_t x3,
+				u_register_t x4,
+				void *cookie,
+				void *handle,
+				u_register_t flags)
+{
+	const smc_stats_entry_t *entry;
+	u_register_t hist[SMC_STATS_HIST_BUCKETS / 2U];
+	unsigned int i;
+
+	switch (smc_fid) {
+	case SMC_STATS_SMC_GET_INFO:
+		/*
+		 * x1 <-- CPU index.
+		 * x0 --> error code.
+		 * x1 --> number of CPUs.
+		 * x2 --> number of entries per CPU.
+		 * x3 --> number of histogram buckets.
+		 * x4 --> log2 of the width ratio of consecutive buckets.
+		 * x5 --> samples dropped on the given CPU.
+		 */
+		if (x1 >= PLATFORM_CORE_COUNT) {
+			SMC_RET1(handle, SMC_STATS_E_INVALID_PARAMS);
+		}
+
+		SMC_RET6(handle, SMC_STATS_E_SUCCESS, PLATFORM_CORE_COUNT,
+			 SMC_STATS_MAX_FIDS, SMC_STATS_HIST_BUCKETS,
+			 SMC_STATS_HIST_LOG2_WIDTH, smc_stats_dropped[x1]);
+
+	case SMC_STATS_SMC_GET_ENTRY:
+		/*
+		 * x1 <-- CPU index.
+		 * x2 <-- entry index.
+		 * x0 --> error code.
+		 * x1 --> SMC function ID.
+		 * x2 --> number of calls, 0 if the entry is unused.
+		 * x3 --> total EL3 residency.
+		 * x4 --> minimum EL3 residency.
+		 * x5 --> maximum EL3 residency.
+		 */
+		entry = smc_stats_get((unsigned int)x1, (unsigned int)x2);
+		if (entry == NULL) {
+			SMC_RET1(handle, SMC_STATS_E_INVALID_PARAMS);
+		}
+
+		SMC_RET6(handle, SMC_STATS_E_SUCCESS, entry->smc_fid,
+			 entry->count, entry->total, entry->min, entry->max);
+
+	case SMC_STATS_SMC_GET_HIST:
+		/*
+		 * x1 <-- CPU index.
+		 * x2 <-- entry index.
+		 * x0 --> error code.
+		 * x1 - x6 --> 32-bit histogram buckets, two per register,
+		 *             lowest bucket in the least significant half of x1.
+		 */
+		entry = smc_stats_get((unsigned int)x1, (unsigned int)x2);
+		if (entry == NULL) {
+			SMC_RET1(handle, SMC_STATS_E_INVALID_PARAMS);
+		}
+
+		for (i = 0U; i < (SMC_STATS_HIST_BUCKETS / 2U); i++) {
+			hist[i] = entry->hist[2U * i] |
+				  ((u_register_t)entry->hist[(2U * i) + 1U] << 32);
+		}
+
+		SMC_RET7(handle, SMC_STATS_E_SUCCESS, hist[0], hist[1], hist[2],
+			 hist[3], hist[4], hist[5]);
+
+	case SMC_STATS_SMC_RESET:
+		smc_stats_reset();
+		SMC_RET1(handle, SMC_STATS_E_SUCCESS);
+
+	default:
+		break;
+	}
+
+	SMC_RET1(handle, SMC_UNK);
+}
@@ -191,6 +191,29 @@ smc_args_t *tsp_cpu_resume_main(uint64_t max_off_pwrlvl,
 	return set_smc_args(TSP_RESUME_DONE, 0, 0, 0, 0, 0, 0, 0);
 }
 
+#if TSP_BENCHMARK
+/*******************************************************************************
+ * This function handles a TSP_BENCH request. It does no work other than, for a
+ * yielding request, busy waiting for 'delay' counter ticks with interrupts
+ * unmasked so that the request can be preempted. The counter values on entry
+ * and exit are returned to the TSPD to split the round trip between EL3 and
+ * S-EL1.
+ ******************************************************************************/
+static smc_args_t *tsp_bench_handler(uint64_t func, uint64_t delay)
+{
+	uint64_t entry_ts = read_cntpct_el0();
+
+	if (((func >> 31) & 1U) == 0U) {
+		while ((read_cntpct_el0() - entry_ts) < delay) {
+			;
+		}
+	}
+
+	return set_smc_args(func, 0, entry_ts, read_cntpct_el0(),
+			    0, 0, 0, 0);
+}
+#endif /* TSP_BENCHMARK */
+
 /*******************************************************************************
  * TSP fast smc handler. The secure monitor jumps to this function by
  * doing the ERET after populating X0-X7 registers. The arguments are received
@@ -213,6 +236,13 @@ smc_args_t *tsp_smc_handler(uint64_t func,
 	uint32_t linear_id = plat_my_core_pos();
 	u_register_t dit;
 
+#if TSP_BENCHMARK
+	/* Keep the benchmark path free of logging and statistics */
+	if (TSP_BARE_FID(func) == TSP_BENCH) {
+		return tsp_bench_handler(func, arg1);
+	}
+#endif
+
 	/* Update this cpu's statistics */
 	tsp_stats[linear_id].smc_count++;
 	tsp_stats[linear_id].eret_count++;
@@ -15,6 +15,7 @@
 #include <common/debug.h>
 #include <drivers/auth/auth_mod.h>
 #include <drivers/io/io_storage.h>
+#include <lib/boot_timing.h>
 #include <lib/utils.h>
 #include <lib/xlat_tables/xlat_tables_defs.h>
 #include <plat/common/platform.h>
@@ -100,6 +101,8 @@ static int load_image(unsigned int image_id, image_info_t *image_data)
 
 	INFO("Loading image id=%u at address 0x%lx\n", image_id, image_base);
 
+	BOOT_TIMING_RECORD(BOOT_TIMING_EV_LOAD_START, image_id);
+
 	/* Find the size of the image */
 	io_result = io_size(image_handle, &image_size);
 	if ((io_result != 0) || (image_size == 0U)) {
@@ -132,6 +135,8 @@ static int load_image(unsigned int image_id, image_info_t *image_data)
 	INFO("Image id=%u loaded: 0x%lx - 0x%lx\n", image_id, image_base,
 	     (uintptr_t)(image_base + image_size));
 
+	BOOT_TIMING_RECORD(BOOT_TIMING_EV_LOAD_END, image_id);
+
 exit:
 	(void)io_close(image_handle);
 	/* Ignore improbable/unrecoverable error in 'close' */
@@ -171,9 +176,11 @@ static int load_auth_image_recursive(unsigned int image_id,
 	}
 
 	/* Authenticate it */
+	BOOT_TIMING_RECORD(BOOT_TIMING_EV_AUTH_START, image_id);
 	rc = auth_mod_verify_img(image_id,
 				 (void *)image_data->image_base,
 				 image_data->image_size);
+	BOOT_TIMING_RECORD(BOOT_TIMING_EV_AUTH_END, image_id);
 	if (rc != 0) {
 		/* Authentication error, zero memory and flush it right away. */
 		zero_normalmem((void *)image_data->image_base,
@@ -11,6 +11,7 @@
 #include <common/bl_common.h>
 #include <common/debug.h>
 #include <common/image_decompress.h>
+#include <lib/boot_timing.h>
 
 static uintptr_t decompressor_buf_base;
 static uint32_t decompressor_buf_size;
@@ -63,9 +64,11 @@ int image_decompress(struct image_info *info)
 	work_base = compressed_image_base + compressed_image_size;
 	work_size = decompressor_buf_size - compressed_image_size;
 
+	BOOT_TIMING_RECORD(BOOT_TIMING_EV_DECOMP_START, INVALID_IMAGE_ID);
 	ret = decompressor(&compressed_image_base, compressed_image_size,
 			   &image_base, info->image_max_size,
 			   work_base, work_size);
+	BOOT_TIMING_RECORD(BOOT_TIMING_EV_DECOMP_END, INVALID_IMAGE_ID);
 	if (ret) {
 		ERROR("Failed to decompress image (err=%d)\n", ret);
 		return ret;
@@ -25,6 +25,127 @@ uint8_t rt_svc_descs_indices[MAX_RT_SVCS];
 #define RT_SVC_DECS_NUM		((RT_SVC_DESCS_END - RT_SVC_DESCS_START)\
 					/ sizeof(rt_svc_desc_t))
 
+#if ENABLE_SMC_FAST_DISPATCH
+/*******************************************************************************
+ * The 'rt_svc_fast_fids' array is a perfect hash table of the function IDs that
+ * services have registered for fast dispatch. The SMC entry path looks up the
+ * incoming function ID in it before falling back to the OEN based dispatch:
+ *
+ *   slot = (smc_fid * rt_svc_fast_fid_mult) >> (32 - RT_SVC_FAST_FID_SLOTS_LOG2)
+ *
+ * The multiplier is recomputed on each registration so that no two registered
+ * function IDs share a slot. Empty slots have a NULL handler.
+ ******************************************************************************/
+rt_svc_fast_fid_t rt_svc_fast_fids[RT_SVC_FAST_FID_SLOTS];
+uint32_t rt_svc_fast_fid_mult;
+
+/* Function IDs registered so far, kept to rebuild the hash table */
+static rt_svc_fast_fid_t fast_fid_list[RT_SVC_FAST_FID_MAX];
+static unsigned int fast_fid_count;
+
+/* Number of odd multipliers tried before giving up on a collision-free hash */
+#define FAST_FID_MULT_TRIES	U(1024)
+#define FAST_FID_MULT_SEED	U(0x9e3779b1)
+
+/* Slot occupancy is tracked in a 32-bit mask while searching for a multiplier */
+CASSERT(RT_SVC_FAST_FID_SLOTS <= 32U, assert_fast_fid_slots_overflow);
+
+static unsigned int fast_fid_slot(uint32_t smc_fid, uint32_t mult)
+{
+	return (smc_fid * mult) >> (32U - RT_SVC_FAST_FID_SLOTS_LOG2);
+}
+
+/*
+ * Find a multiplier which maps 'count' function IDs from 'list' to distinct
+ * slots. Returns 0 if none of the candidates does.
+ */
+static uint32_t fast_fid_find_mult(const rt_svc_fast_fid_t *list,
+				   unsigned int count)
+{
+	unsigned int i, j;
+	uint32_t mult, used;
+
+	for (i = 0U; i < FAST_FID_MULT_TRIES; i++) {
+		mult = FAST_FID_MULT_SEED + (i << 1);
+		used = 0U;
+
+		for (j = 0U; j < count; j++) {
+			uint32_t bit = U(1) << fast_fid_slot(list[j].smc_fid,
+							     mult);
+
+			if ((used & bit) != 0U) {
+				break;
+			}
+			used |= bit;
+		}
+
+		if (j == count) {
+			return mult;
+		}
+	}
+
+	return 0U;
+}
+
+/*******************************************************************************
+ * Route 'smc_fid' straight to 'handle' from the SMC entry path, bypassing the
+ * owning service's top level handler. The handler is called with the same
+ * arguments as a runtime service handler, and it is the responsibility of the
+ * caller to make it behave exactly as the owning service would for that ID.
+ * This must only be called during cold boot, before secondary CPUs are
+ * released. Returns 0 on success. On failure the ID keeps using the generic
+ * dispatch path.
+ ******************************************************************************/
+int rt_svc_register_fast_fid(uint32_t smc_fid, rt_svc_handle_t handle)
+{
+	unsigned int i;
+	uint32_t mult;
+
+	if (handle == NULL) {
+		return -EINVAL;
+	}
+
+	for (i = 0U; i < fast_fid_count; i++) {
+		if (fast_fid_list[i].smc_fid == smc_fid) {
+			return -EEXIST;
+		}
+	}
+
+	if (fast_fid_count == RT_SVC_FAST_FID_MAX) {
+		WARN("No room to register SMC 0x%x for fast dispatch\n",
+		     smc_fid);
+		return -ENOMEM;
+	}
+
+	fast_fid_list[fast_fid_count].smc_fid = smc_fid;
+	fast_fid_list[fast_fid_count].handle = handle;
+
+	mult = fast_fid_find_mult(fast_fid_list, fast_fid_count + 1U);
+	if (mult == 0U) {
+		WARN("No collision-free slot for SMC 0x%x fast dispatch\n",
+		     smc_fid);
+		return -ENOSPC;
+	}
+
+	fast_fid_count++;
+
+	/*
+	 * Rebuild the table from scratch. Nothing else is running yet so
+	 * there is no need to keep the table consistent while doing so.
+	 */
+	(void)memset(rt_svc_fast_fids, 0, sizeof(rt_svc_fast_fids));
+	for (i = 0U; i < fast_fid_count; i++) {
+		rt_svc_fast_fids[fast_fid_slot(fast_fid_list[i].smc_fid,
+					       mult)] = fast_fid_list[i];
+	}
+	rt_svc_fast_fid_mult = mult;
+
+	VERBOSE("SMC 0x%x registered for fast dispatch\n", smc_fid);
+
+	return 0;
+}
+#endif /* ENABLE_SMC_FAST_DISPATCH */
+
 /*******************************************************************************
  * Function to invoke the registered `handle` corresponding to the smc_fid in
  * AArch32 mode.
@@ -291,10 +291,12 @@ int css_scp_get_power_state(u_register_t mpidr, unsigned int power_level)
  * Callback function to raise a SGI designated to trigger the CPU power down
  * sequence on all the online secondary cores.
  */
-static void css_raise_pwr_down_interrupt(u_register_t mpidr)
+static void css_raise_pwr_down_interrupt(const u_register_t *mpidrs,
+					 unsigned int num_mpidrs)
 {
 #if CSS_SYSTEM_GRACEFUL_RESET
-	plat_ic_raise_el3_sgi(CSS_CPU_PWR_DOWN_REQ_INTR, mpidr);
+	plat_ic_raise_el3_sgi_multi(CSS_CPU_PWR_DOWN_REQ_INTR, mpidrs,
+				    num_mpidrs);
 #endif
 }
 
@@ -312,7 +314,7 @@ void __dead2 css_scp_system_off(int state)
 	/*
 	 * Send powerdown request to online secondary core(s)
 	 */
-	ret = psci_stop_other_cores(0, css_raise_pwr_down_interrupt);
+	ret = psci_stop_other_cores_multi(0, css_raise_pwr_down_interrupt);
 	if (ret != PSCI_E_SUCCESS) {
 		ERROR("Failed to powerdown secondary core(s)\n");
 	}
@@ -12,6 +12,8 @@ GICV3_IMPL_GIC600_MULTICHIP	?=	0
 GICV3_OVERRIDE_DISTIF_PWR_OPS	?=	0
 GIC_ENABLE_V4_EXTN		?=	0
 GIC_EXT_INTID			?=	0
+GICV3_RDIST_SHADOW		?=	0
+GICV3_DIST_SPARSE_RESTORE	?=	0
 GIC600_ERRATA_WA_2384374	?=	${GICV3_SUPPORT_GIC600}
 
 GICV3_SOURCES	+=	drivers/arm/gic/v3/gicv3_main.c		\
@@ -53,6 +55,14 @@ $(eval $(call add_define,GIC_ENABLE_V4_EXTN))
 $(eval $(call assert_boolean,GIC_EXT_INTID))
 $(eval $(call add_define,GIC_EXT_INTID))
 
+# Set Redistributor shadow state support
+$(eval $(call assert_boolean,GICV3_RDIST_SHADOW))
+$(eval $(call add_define,GICV3_RDIST_SHADOW))
+
+# Set sparse Distributor restore support
+$(eval $(call assert_boolean,GICV3_DIST_SPARSE_RESTORE))
+$(eval $(call add_define,GICV3_DIST_SPARSE_RESTORE))
+
 # Set errata workaround for GIC600/GIC600AE
 $(eval $(call assert_boolean,GIC600_ERRATA_WA_2384374))
 $(eval $(call add_define,GIC600_ERRATA_WA_2384374))
@@ -16,6 +16,8 @@
 #include <lib/spinlock.h>
 #include <plat/common/platform.h>
 
+#include <platform_def.h>
+
 #include "gicv3_private.h"
 
 const gicv3_driver_data_t *gicv3_driver_data;
@@ -27,6 +29,66 @@ const gicv3_driver_data_t *gicv3_driver_data;
  */
 static spinlock_t gic_lock;
 
+#if GICV3_RDIST_SHADOW
+/*
+ * Shadow copy of the Redistributor registers that only Secure software can
+ * write: GICR_IGROUPR<n>E, GICR_IGRPMODR<n>E and GICR_NSACR. It is filled when
+ * the registers are saved or restored and invalidated when the driver writes
+ * them, so that they are not read back on every power down. This relies on no
+ * Secure software other than this driver programming these registers.
+ */
+typedef struct gicv3_rdist_shadow {
+	bool valid;
+	uint32_t igroupr[GICR_NUM_REGS(IGROUPR)];
+	uint32_t igrpmodr[GICR_NUM_REGS(IGRPMODR)];
+	uint32_t nsacr;
+} gicv3_rdist_shadow_t;
+
+static gicv3_rdist_shadow_t gicv3_rdist_shadow[PLATFORM_CORE_COUNT];
+
+static void gicv3_rdist_shadow_update(unsigned int proc_num,
+				      unsigned int ppi_regs_num,
+				      const gicv3_redist_ctx_t *rdist_ctx)
+{
+	gicv3_rdist_shadow_t *shadow;
+	unsigned int i;
+
+	assert(proc_num < PLATFORM_CORE_COUNT);
+	shadow = &gicv3_rdist_shadow[proc_num];
+
+	for (i = 0U; i < ppi_regs_num; ++i) {
+		shadow->igroupr[i] = rdist_ctx->gicr_igroupr[i];
+		shadow->igrpmodr[i] = rdist_ctx->gicr_igrpmodr[i];
+	}
+	shadow->nsacr = rdist_ctx->gicr_nsacr;
+	shadow->valid = true;
+}
+
+static void gicv3_rdist_shadow_invalidate(unsigned int proc_num)
+{
+	assert(proc_num < PLATFORM_CORE_COUNT);
+	gicv3_rdist_shadow[proc_num].valid = false;
+}
+
+/*
+ * Writing zero to GICR_ISENABLER<n>E, GICR_ISPENDR<n>E or GICR_ISACTIVER<n>E
+ * has no effect, so only restore the registers with bits set.
+ */
+#define RESTORE_GICR_SET_REG(base, ctx, name, i)		\
+	do {							\
+		if ((ctx)->gicr_##name[(i)] != 0U) {		\
+			RESTORE_GICR_REG(base, ctx, name, i);	\
+		}						\
+	} while (false)
+#else
+static inline void gicv3_rdist_shadow_invalidate(unsigned int proc_num)
+{
+}
+
+#define RESTORE_GICR_SET_REG(base, ctx, name, i)	\
+	RESTORE_GICR_REG(base, ctx, name, i)
+#endif /* GICV3_RDIST_SHADOW */
+
 /*
  * Redistributor power operations are weakly bound so that they can be
  * overridden
@@ -47,14 +109,27 @@ static bool is_sgi_ppi(unsigned int id);
 #define SAVE_GICR_REG(base, ctx, name, i)	\
 	(ctx)->gicr_##name[(i)] = gicr_read_##name((base), (i))
 
+/*
+ * With GICV3_DIST_SPARSE_RESTORE, the Distributor registers are known to hold
+ * either their saved value or zero on restore, so zero values are not written.
+ */
+#if GICV3_DIST_SPARSE_RESTORE
+#define GICD_RESTORE_NEEDED(val)	((val) != 0U)
+#else
+#define GICD_RESTORE_NEEDED(val)	true
+#endif
+
 /* Helper macros to save and restore GICD registers to and from the context */
 #define RESTORE_GICD_REGS(base, ctx, intr_num, reg, REG)		\
 	do {								\
 		for (unsigned int int_id = MIN_SPI_ID; int_id < (intr_num);\
 				int_id += (1U << REG##R_SHIFT)) {	\
-			gicd_write_##reg((base), int_id,		\
-				(ctx)->gicd_##reg[(int_id - MIN_SPI_ID) >> \
-							REG##R_SHIFT]);	\
+			unsigned int idx = (int_id - MIN_SPI_ID) >>	\
+						REG##R_SHIFT;		\
+			if (GICD_RESTORE_NEEDED((ctx)->gicd_##reg[idx])) { \
+				gicd_write_##reg((base), int_id,	\
+					(ctx)->gicd_##reg[idx]);	\
+			}						\
 		}							\
 	} while (false)
 
@@ -72,10 +147,13 @@ static bool is_sgi_ppi(unsigned int id);
 	do {								\
 		for (unsigned int int_id = MIN_ESPI_ID; int_id < (intr_num);\
 				int_id += (1U << REG##R_SHIFT)) {	\
-			gicd_write_##reg((base), int_id,		\
-			(ctx)->gicd_##reg[(int_id - (MIN_ESPI_ID -	\
+			unsigned int idx = (int_id - (MIN_ESPI_ID -	\
 			round_up(TOTAL_SPI_INTR_NUM, 1U << REG##R_SHIFT)))\
-						>> REG##R_SHIFT]);	\
+						>> REG##R_SHIFT;	\
+			if (GICD_RESTORE_NEEDED((ctx)->gicd_##reg[idx])) { \
+				gicd_write_##reg((base), int_id,	\
+					(ctx)->gicd_##reg[idx]);	\
+			}						\
 		}							\
 	} while (false)
 
@@ -246,6 +324,8 @@ void gicv3_rdistif_init(unsigned int proc_num)
 	gicr_base = gicv3_driver_data->rdistif_base_addrs[proc_num];
 	assert(gicr_base != 0U);
 
+	gicv3_rdist_shadow_invalidate(proc_num);
+
 	/* Set the default attribute of all SGIs and (E)PPIs */
 	gicv3_ppi_sgi_config_defaults(gicr_base);
 
@@ -550,6 +630,46 @@ void gicv3_its_restore(uintptr_t gits_base,
 	gits_write_ctlr(gits_base, its_ctx->gits_ctlr & ~GITS_CTLR_ENABLED_BIT);
 }
 
+/*****************************************************************************
+ * Save the Redistributor registers that only Secure software can write. With
+ * GICV3_RDIST_SHADOW, they are taken from the shadow copy when it is valid.
+ *****************************************************************************/
+static void gicv3_rdistif_save_secure(unsigned int proc_num,
+				      uintptr_t gicr_base,
+				      unsigned int ppi_regs_num,
+				      gicv3_redist_ctx_t * const rdist_ctx)
+{
+	unsigned int i;
+
+#if GICV3_RDIST_SHADOW
+	const gicv3_rdist_shadow_t *shadow;
+
+	assert(proc_num < PLATFORM_CORE_COUNT);
+	shadow = &gicv3_rdist_shadow[proc_num];
+
+	if (shadow->valid) {
+		for (i = 0U; i < ppi_regs_num; ++i) {
+			rdist_ctx->gicr_igroupr[i] = shadow->igroupr[i];
+			rdist_ctx->gicr_igrpmodr[i] = shadow->igrpmodr[i];
+		}
+		rdist_ctx->gicr_nsacr = shadow->nsacr;
+		return;
+	}
+#endif
+
+	/* 32 interrupt IDs per register */
+	for (i = 0U; i < ppi_regs_num; ++i) {
+		SAVE_GICR_REG(gicr_base, rdist_ctx, igroupr, i);
+		SAVE_GICR_REG(gicr_base, rdist_ctx, igrpmodr, i);
+	}
+
+	rdist_ctx->gicr_nsacr = gicr_read_nsacr(gicr_base);
+
+#if GICV3_RDIST_SHADOW
+	gicv3_rdist_shadow_update(proc_num, ppi_regs_num, rdist_ctx);
+#endif
+}
+
 /*****************************************************************************
  * Function to save the GIC Redistributor register context. This function
  * must be invoked after CPU interface disable and prior to Distributor save.
@@ -592,21 +712,19 @@ void gicv3_rdistif_save(unsigned int proc_num,
 
 	/* 32 interrupt IDs per register */
 	for (i = 0U; i < ppi_regs_num; ++i) {
-		SAVE_GICR_REG(gicr_base, rdist_ctx, igroupr, i);
 		SAVE_GICR_REG(gicr_base, rdist_ctx, isenabler, i);
 		SAVE_GICR_REG(gicr_base, rdist_ctx, ispendr, i);
 		SAVE_GICR_REG(gicr_base, rdist_ctx, isactiver, i);
-		SAVE_GICR_REG(gicr_base, rdist_ctx, igrpmodr, i);
 	}
 
+	gicv3_rdistif_save_secure(proc_num, gicr_base, ppi_regs_num, rdist_ctx);
+
 	/* 16 interrupt IDs per GICR_ICFGR register */
 	regs_num = ppi_regs_num << 1;
 	for (i = 0U; i < regs_num; ++i) {
 		SAVE_GICR_REG(gicr_base, rdist_ctx, icfgr, i);
 	}
 
-	rdist_ctx->gicr_nsacr = gicr_read_nsacr(gicr_base);
-
 	/* 4 interrupt IDs per GICR_IPRIORITYR register */
 	regs_num = ppi_regs_num << 3;
 	for (i = 0U; i < regs_num; ++i) {
@@ -708,12 +826,16 @@ void gicv3_rdistif_init_restore(unsigned int proc_num,
 
 	gicr_write_nsacr(gicr_base, rdist_ctx->gicr_nsacr);
 
+#if GICV3_RDIST_SHADOW
+	gicv3_rdist_shadow_update(proc_num, ppi_regs_num, rdist_ctx);
+#endif
+
 	/* Restore after group and priorities are set.
 	 * 32 interrupt IDs per register
 	 */
 	for (i = 0U; i < ppi_regs_num; ++i) {
-		RESTORE_GICR_REG(gicr_base, rdist_ctx, ispendr, i);
-		RESTORE_GICR_REG(gicr_base, rdist_ctx, isactiver, i);
+		RESTORE_GICR_SET_REG(gicr_base, rdist_ctx, ispendr, i);
+		RESTORE_GICR_SET_REG(gicr_base, rdist_ctx, isactiver, i);
 	}
 
 	/*
@@ -724,7 +846,7 @@ void gicv3_rdistif_init_restore(unsigned int proc_num,
 
 	/* 32 interrupt IDs per GICR_ISENABLER register */
 	for (i = 0U; i < ppi_regs_num; ++i) {
-		RESTORE_GICR_REG(gicr_base, rdist_ctx, isenabler, i);
+		RESTORE_GICR_SET_REG(gicr_base, rdist_ctx, isenabler, i);
 	}
 
 	/*
@@ -827,6 +949,10 @@ void gicv3_distif_save(gicv3_dist_ctx_t * const dist_ctx)
  * function must be invoked prior to Redistributor restore and CPU interface
  * enable. The pending and active interrupts are restored after the interrupts
  * are fully configured and enabled.
+ *
+ * With GICV3_DIST_SPARSE_RESTORE, the registers whose saved value is zero are
+ * skipped. This requires each of them to either have retained its value or
+ * have been reset to zero when this function is called.
  *****************************************************************************/
 void gicv3_distif_init_restore(const gicv3_dist_ctx_t * const dist_ctx)
 {
@@ -1094,6 +1220,7 @@ void gicv3_set_interrupt_type(unsigned int id, unsigned int proc_num,
 		/* For SGIs: 0-15, PPIs: 16-31 and EPPIs: 1056-1119 */
 		gicr_base = gicv3_driver_data->rdistif_base_addrs[proc_num];
 
+		gicv3_rdist_shadow_invalidate(proc_num);
 		igroup ? gicr_set_igroupr(gicr_base, id) :
 			 gicr_clr_igroupr(gicr_base, id);
 		grpmod ? gicr_set_igrpmodr(gicr_base, id) :
@@ -1115,6 +1242,41 @@ void gicv3_set_interrupt_type(unsigned int id, unsigned int proc_num,
 	}
 }
 
+/* Affinity levels 1 to 3 of an MPIDR, which share a single SGI target list */
+#define SGIR_CLUSTER_MASK	(MPIDR_AFFINITY_MASK & ~MPIDR_AFFLVL_MASK)
+
+/*******************************************************************************
+ * Helpers to build an SGI generation value for the PEs of the cluster of
+ * 'mpidr' in the 'tgt' target list, and to write it to the SGI generation
+ * register of the specified group.
+ ******************************************************************************/
+static uint64_t gicv3_sgir_value(unsigned int sgi_num, u_register_t mpidr,
+				 unsigned int tgt)
+{
+	return GICV3_SGIR_VALUE(MPIDR_AFFLVL3_VAL(mpidr),
+				MPIDR_AFFLVL2_VAL(mpidr),
+				MPIDR_AFFLVL1_VAL(mpidr),
+				sgi_num, SGIR_IRM_TO_AFF, tgt);
+}
+
+static void gicv3_write_sgir(gicv3_irq_group_t group, uint64_t sgi_val)
+{
+	switch (group) {
+	case GICV3_G0:
+		write_icc_sgi0r_el1(sgi_val);
+		break;
+	case GICV3_G1NS:
+		write_icc_asgi1r(sgi_val);
+		break;
+	case GICV3_G1S:
+		write_icc_sgi1r(sgi_val);
+		break;
+	default:
+		assert(false);
+		break;
+	}
+}
+
 /*******************************************************************************
  * This function raises the specified SGI of the specified group.
  *
@@ -1123,28 +1285,21 @@ void gicv3_set_interrupt_type(unsigned int id, unsigned int proc_num,
 void gicv3_raise_sgi(unsigned int sgi_num, gicv3_irq_group_t group,
 		u_register_t target)
 {
-	unsigned int tgt, aff3, aff2, aff1, aff0;
+	unsigned int aff0;
 	uint64_t sgi_val;
 
 	/* Verify interrupt number is in the SGI range */
 	assert((sgi_num >= MIN_SGI_ID) && (sgi_num < MIN_PPI_ID));
 
-	/* Extract affinity fields from target */
-	aff0 = MPIDR_AFFLVL0_VAL(target);
-	aff1 = MPIDR_AFFLVL1_VAL(target);
-	aff2 = MPIDR_AFFLVL2_VAL(target);
-	aff3 = MPIDR_AFFLVL3_VAL(target);
-
 	/*
 	 * Make target list from affinity 0, and ensure GICv3 SGI can target
 	 * this PE.
 	 */
+	aff0 = MPIDR_AFFLVL0_VAL(target);
 	assert(aff0 < GICV3_MAX_SGI_TARGETS);
-	tgt = BIT_32(aff0);
 
 	/* Raise SGI to PE specified by its affinity */
-	sgi_val = GICV3_SGIR_VALUE(aff3, aff2, aff1, sgi_num, SGIR_IRM_TO_AFF,
-			tgt);
+	sgi_val = gicv3_sgir_value(sgi_num, target, BIT_32(aff0));
 
 	/*
 	 * Ensure that any shared variable updates depending on out of band
@@ -1152,19 +1307,51 @@ void gicv3_raise_sgi(unsigned int sgi_num, gicv3_irq_group_t group,
 	 */
 	dsbishst();
 
-	switch (group) {
-	case GICV3_G0:
-		write_icc_sgi0r_el1(sgi_val);
-		break;
-	case GICV3_G1NS:
-		write_icc_asgi1r(sgi_val);
-		break;
-	case GICV3_G1S:
-		write_icc_sgi1r(sgi_val);
-		break;
-	default:
-		assert(false);
-		break;
+	gicv3_write_sgir(group, sgi_val);
+
+	isb();
+}
+
+/*******************************************************************************
+ * This function raises the specified SGI of the specified group on each PE of
+ * the 'targets' array of MPIDRs. Consecutive targets of the same cluster, i.e.
+ * sharing affinity levels 1 to 3, are signalled with a single write of up to
+ * GICV3_MAX_SGI_TARGETS PEs, so the targets should be ordered by cluster.
+ ******************************************************************************/
+void gicv3_raise_sgi_multi(unsigned int sgi_num, gicv3_irq_group_t group,
+		const u_register_t *targets, unsigned int num_targets)
+{
+	u_register_t cluster = 0U;
+	unsigned int i, aff0, tgt = 0U;
+
+	/* Verify interrupt number is in the SGI range */
+	assert((sgi_num >= MIN_SGI_ID) && (sgi_num < MIN_PPI_ID));
+	assert((targets != NULL) || (num_targets == 0U));
+
+	/*
+	 * Ensure that any shared variable updates depending on out of band
+	 * interrupt trigger are observed before raising SGI.
+	 */
+	dsbishst();
+
+	for (i = 0U; i < num_targets; i++) {
+		aff0 = MPIDR_AFFLVL0_VAL(targets[i]);
+		assert(aff0 < GICV3_MAX_SGI_TARGETS);
+
+		/* Signal the PEs gathered so far when the cluster changes */
+		if ((tgt != 0U) &&
+		    ((targets[i] & SGIR_CLUSTER_MASK) != cluster)) {
+			gicv3_write_sgir(group,
+					 gicv3_sgir_value(sgi_num, cluster, tgt));
+			tgt = 0U;
+		}
+
+		cluster = targets[i] & SGIR_CLUSTER_MASK;
+		tgt |= BIT_32(aff0);
+	}
+
+	if (tgt != 0U) {
+		gicv3_write_sgir(group, gicv3_sgir_value(sgi_num, cluster, tgt));
 	}
 
 	isb();
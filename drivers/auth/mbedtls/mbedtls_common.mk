@@ -37,6 +37,7 @@ LIBMBEDTLS_SRCS		+= $(addprefix ${MBEDTLS_DIR}/library/,		\
 					cipher.c 			\
 					cipher_wrap.c 			\
 					constant_time.c			\
+					ctr_drbg.c			\
 					memory_buffer_alloc.c		\
 					oid.c 				\
 					platform.c 			\
@@ -123,6 +124,12 @@ else
     TF_MBEDTLS_USE_AES_GCM	:=	0
 endif
 
+ifeq (${TRNG_DRBG_SUPPORT}, 1)
+    TF_MBEDTLS_USE_CTR_DRBG	:=	1
+else
+    TF_MBEDTLS_USE_CTR_DRBG	:=	0
+endif
+
 # Needs to be set to drive mbed TLS configuration correctly
 $(eval $(call add_defines,\
     $(sort \
@@ -130,6 +137,7 @@ $(eval $(call add_defines,\
         TF_MBEDTLS_KEY_SIZE \
         TF_MBEDTLS_HASH_ALG_ID \
         TF_MBEDTLS_USE_AES_GCM \
+        TF_MBEDTLS_USE_CTR_DRBG \
 )))
 
 $(eval $(call MAKE_LIB,mbedtls))
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef EHF_STATS_H
+#define EHF_STATS_H
+
+#include <lib/utils_def.h>
+
+/*
+ * Defines for EHF statistics SMC function ids, part of the SiP range.
+ */
+#define EHF_STATS_SMC_GET_INFO		U(0xC20000A0)
+#define EHF_STATS_SMC_GET_PRI		U(0xC20000A1)
+#define EHF_STATS_SMC_RESET		U(0xC20000A2)
+#define EHF_STATS_NUM_SMC_CALLS		3
+
+/* Error codes returned by the EHF statistics SMCs */
+#define EHF_STATS_E_SUCCESS		0
+#define EHF_STATS_E_INVALID_PARAMS	-2
+
+#ifndef __ASSEMBLER__
+
+#include <stdint.h>
+
+#include <bl31/ehf.h>
+
+/* Maximum number of priority levels the EHF can manage */
+#define EHF_STATS_MAX_PRIORITIES	(sizeof(ehf_pri_bits_t) * 8U)
+
+/*
+ * Statistics of one EHF priority level on one CPU. Times are in system counter
+ * (CNTPCT_EL0) ticks. The time spent at a level includes the time spent at
+ * higher priority levels that preempted it.
+ */
+typedef struct ehf_stats_pri {
+	/* Interrupts handled, and explicit activations, at this level */
+	uint64_t interrupts;
+	uint64_t activations;
+
+	/* Time spent at this level */
+	uint64_t total;
+	uint64_t max;
+
+	/* Time from entry into EL3 to entry into the interrupt handler */
+	uint64_t latency_total;
+	uint64_t latency_max;
+
+	/* Start of the ongoing stay at this level, if any */
+	uint64_t start;
+} ehf_stats_pri_t;
+
+#if ENABLE_EHF_STATS
+
+void ehf_stats_record_entry(void);
+void ehf_stats_intr_enter(unsigned int idx);
+void ehf_stats_intr_exit(unsigned int idx);
+void ehf_stats_activate(unsigned int idx);
+void ehf_stats_deactivate(unsigned int idx);
+void ehf_stats_ns_masked(void);
+void ehf_stats_ns_unmasked(void);
+uintptr_t ehf_stats_smc_handler(unsigned int smc_fid,
+				u_register_t x1,
+				u_register_t x2,
+				u_register_t x3,
+				u_register_t x4,
+				void *cookie,
+				void *handle,
+				u_register_t flags);
+
+#else
+
+static inline void ehf_stats_intr_enter(unsigned int idx)
+{
+}
+
+static inline void ehf_stats_intr_exit(unsigned int idx)
+{
+}
+
+static inline void ehf_stats_activate(unsigned int idx)
+{
+}
+
+static inline void ehf_stats_deactivate(unsigned int idx)
+{
+}
+
+static inline void ehf_stats_ns_masked(void)
+{
+}
+
+static inline void ehf_stats_ns_unmasked(void)
+{
+}
+
+#endif /* ENABLE_EHF_STATS */
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* EHF_STATS_H */
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef SMC_STATS_H
+#define SMC_STATS_H
+
+#include <lib/utils_def.h>
+
+/*
+ * Number of distinct SMC function IDs tracked per CPU. Must be a power of 2.
+ */
+#ifdef PLAT_SMC_STATS_MAX_FIDS
+#define SMC_STATS_MAX_FIDS		PLAT_SMC_STATS_MAX_FIDS
+#else
+#define SMC_STATS_MAX_FIDS		U(32)
+#endif
+
+/*
+ * Latency histogram. Bucket 'n' counts the SMCs whose EL3 residency, in
+ * system counter ticks, is in the range [4^n, 4^(n+1)). The last bucket also
+ * counts all longer residencies.
+ */
+#define SMC_STATS_HIST_BUCKETS		U(12)
+#define SMC_STATS_HIST_LOG2_WIDTH	U(2)
+
+/*
+ * Defines for SMC statistics SMC function ids, part of the SiP range.
+ */
+#define SMC_STATS_SMC_GET_INFO		U(0xC2000070)
+#define SMC_STATS_SMC_GET_ENTRY		U(0xC2000071)
+#define SMC_STATS_SMC_GET_HIST		U(0xC2000072)
+#define SMC_STATS_SMC_RESET		U(0xC2000073)
+#define SMC_STATS_NUM_SMC_CALLS		4
+
+/* Error codes returned by the SMC statistics SMCs */
+#define SMC_STATS_E_SUCCESS		0
+#define SMC_STATS_E_INVALID_PARAMS	-2
+
+#ifndef __ASSEMBLER__
+
+#include <stdint.h>
+
+/*
+ * EL3 residency statistics of one SMC function ID on one CPU. Times are in
+ * system counter (CNTPCT_EL0) ticks. An entry is unused if 'count' is zero.
+ */
+typedef struct smc_stats_entry {
+	uint32_t smc_fid;
+	uint64_t count;
+	uint64_t total;
+	uint64_t min;
+	uint64_t max;
+	uint32_t hist[SMC_STATS_HIST_BUCKETS];
+} smc_stats_entry_t;
+
+void smc_stats_record(uint32_t smc_fid, uint64_t entry_ts);
+const smc_stats_entry_t *smc_stats_get(unsigned int cpu_idx,
+				       unsigned int idx);
+void smc_stats_reset(void);
+uintptr_t smc_stats_smc_handler(unsigned int smc_fid,
+				u_register_t x1,
+				u_register_t x2,
+				u_register_t x3,
+				u_register_t x4,
+				void *cookie,
+				void *handle,
+				u_register_t flags);
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* SMC_STATS_H */
@@ -42,6 +42,7 @@
 #define TSP_DIV		0x2003
 #define TSP_HANDLE_SEL1_INTR_AND_RETURN	0x2004
 #define TSP_CHECK_DIT	0x2005
+#define TSP_BENCH	0x2006
 
 /*
  * Identify a TSP service from function ID filtering the last 16 bits from the
@@ -65,11 +66,50 @@
  */
 #define TSP_FID_ABORT		TSP_FAST_FID(0x3001)
 
+/*
+ * SMC function IDs to read and clear the round trip latency statistics
+ * gathered by the TSPD when built with TSP_BENCHMARK=1. They are handled in
+ * EL3 and do not enter the TSP.
+ */
+#define TSP_FID_BENCH_GET	TSP_FAST_FID(0x3002)
+#define TSP_FID_BENCH_RESET	TSP_FAST_FID(0x3003)
+
+/*
+ * Round trips measured by the TSPD in benchmark mode:
+ * - a fast TSP_BENCH request,
+ * - a yielding TSP_BENCH request which completes without being preempted,
+ * - a yielding TSP_BENCH request until it returns SMC_PREEMPTED,
+ * - a TSP_FID_RESUME of a preempted TSP_BENCH request until it completes,
+ * - an S-EL1 interrupt taken from the Normal world until it returns there.
+ */
+#define TSP_BENCH_FAST		0
+#define TSP_BENCH_YIELD		1
+#define TSP_BENCH_PREEMPT	2
+#define TSP_BENCH_RESUME	3
+#define TSP_BENCH_SEL1_INTR	4
+#define TSP_BENCH_CATEGORIES	5
+
+/*
+ * PMF timestamp IDs captured by the TSPD in benchmark mode for the last
+ * TSP_BENCH request on each CPU. They can be read from the Normal world with
+ * PMF_SMC_GET_TIMESTAMP using the PMF_TSP_BENCH_SVC_ID service.
+ */
+#define TSP_BENCH_ENTER_EL3	0	/* Request received by the TSPD */
+#define TSP_BENCH_ENTER_SEL1	1	/* Request received by the TSP */
+#define TSP_BENCH_EXIT_SEL1	2	/* Response sent by the TSP */
+#define TSP_BENCH_EXIT_EL3	3	/* Response returned to the Normal world */
+#define TSP_BENCH_TOTAL_IDS	4
+
 /*
  * Total number of function IDs implemented for services offered to NS clients.
- * The function IDs are defined above
+ * The function IDs are defined above. The benchmark mode adds TSP_BENCH,
+ * TSP_FID_BENCH_GET and TSP_FID_BENCH_RESET.
  */
+#if TSP_BENCHMARK
+#define TSP_NUM_FID		0x8
+#else
 #define TSP_NUM_FID		0x5
+#endif
 
 /* TSP implementation version numbers */
 #define TSP_VERSION_MAJOR	0x0 /* Major version */
@@ -39,6 +39,21 @@
  */
 #define MAX_RT_SVCS		U(128)
 
+/*
+ * Constants to allow the assembler access the hot SMC function ID table used
+ * by the fast dispatch path. Each entry holds a function ID and the handler it
+ * is routed to. The table is indexed by a multiplicative hash of the function
+ * ID which is chosen at boot so that every registered ID owns its own slot.
+ */
+#define RT_SVC_FAST_FID_SIZE_LOG2	U(4)
+#define RT_SVC_FAST_FID_HANDLE		U(8)
+#define RT_SVC_FAST_FID_SLOTS_LOG2	U(4)
+#define RT_SVC_FAST_FID_SLOTS		(U(1) << RT_SVC_FAST_FID_SLOTS_LOG2)
+#define SIZEOF_RT_SVC_FAST_FID		(U(1) << RT_SVC_FAST_FID_SIZE_LOG2)
+
+/* Maximum number of function IDs that can be registered for fast dispatch */
+#define RT_SVC_FAST_FID_MAX		U(8)
+
 #ifndef __ASSEMBLER__
 
 /* Prototype for runtime service initializing function */
@@ -97,6 +112,22 @@ CASSERT(RT_SVC_DESC_INIT == __builtin_offsetof(rt_svc_desc_t, init),
 CASSERT(RT_SVC_DESC_HANDLE == __builtin_offsetof(rt_svc_desc_t, handle),
 	assert_rt_svc_desc_handle_offset_mismatch);
 
+#if ENABLE_SMC_FAST_DISPATCH
+/*
+ * Entry of the hot SMC function ID table. A slot with a NULL handler is empty.
+ */
+typedef struct rt_svc_fast_fid {
+	uint32_t smc_fid;
+	uint32_t reserved;
+	rt_svc_handle_t handle;
+} rt_svc_fast_fid_t;
+
+CASSERT((sizeof(rt_svc_fast_fid_t) == SIZEOF_RT_SVC_FAST_FID),
+	assert_sizeof_rt_svc_fast_fid_mismatch);
+CASSERT(RT_SVC_FAST_FID_HANDLE == __builtin_offsetof(rt_svc_fast_fid_t, handle),
+	assert_rt_svc_fast_fid_handle_offset_mismatch);
+#endif /* ENABLE_SMC_FAST_DISPATCH */
+
 
 /*
  * This function combines the call type and the owning entity number
@@ -134,5 +165,18 @@ void init_crash_reporting(void);
 
 extern uint8_t rt_svc_descs_indices[MAX_RT_SVCS];
 
+#if ENABLE_SMC_FAST_DISPATCH
+int rt_svc_register_fast_fid(uint32_t smc_fid, rt_svc_handle_t handle);
+
+extern rt_svc_fast_fid_t rt_svc_fast_fids[RT_SVC_FAST_FID_SLOTS];
+extern uint32_t rt_svc_fast_fid_mult;
+#else
+static inline int rt_svc_register_fast_fid(uint32_t smc_fid,
+					   rt_svc_handle_t handle)
+{
+	return 0;
+}
+#endif /* ENABLE_SMC_FAST_DISPATCH */
+
 #endif /*__ASSEMBLER__*/
 #endif /* RUNTIME_SVC_H */
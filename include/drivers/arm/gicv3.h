@@ -583,6 +583,8 @@ void gicv3_set_interrupt_type(unsigned int id, unsigned int proc_num,
 		unsigned int type);
 void gicv3_raise_sgi(unsigned int sgi_num, gicv3_irq_group_t group,
 					 u_register_t target);
+void gicv3_raise_sgi_multi(unsigned int sgi_num, gicv3_irq_group_t group,
+		const u_register_t *targets, unsigned int num_targets);
 void gicv3_set_spi_routing(unsigned int id, unsigned int irm,
 		u_register_t mpidr);
 void gicv3_set_interrupt_pending(unsigned int id, unsigned int proc_num);
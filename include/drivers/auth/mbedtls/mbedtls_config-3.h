@@ -99,6 +99,13 @@
 #define MBEDTLS_GCM_C
 #endif
 
+#if TF_MBEDTLS_USE_CTR_DRBG
+#ifndef MBEDTLS_AES_C
+#define MBEDTLS_AES_C
+#endif
+#define MBEDTLS_CTR_DRBG_C
+#endif
+
 /* MPI / BIGNUM options */
 #define MBEDTLS_MPI_WINDOW_SIZE			2
 
@@ -56,6 +56,8 @@ enum bl_aux_param_type {
 	BL_AUX_PARAM_VENDOR_SPECIFIC_LAST = 0x7fffffff,
 	BL_AUX_PARAM_GENERIC_FIRST = 0x80000001,
 	BL_AUX_PARAM_COREBOOT_TABLE = BL_AUX_PARAM_GENERIC_FIRST,
+	/* Boot timing records of the previous stages (uint64: address) */
+	BL_AUX_PARAM_BOOT_TIMING,
 	/* 0x80000001 - 0xffffffff are reserved for the generic handler. */
 	BL_AUX_PARAM_GENERIC_LAST = 0xffffffff,
 	/* Top 32 bits of the type field are reserved for future use. */
@@ -16,6 +16,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include <lib/lock_stats.h>
 #include <lib/utils_def.h>
 
 /*****************************************************************************
@@ -51,7 +52,18 @@ static inline uint16_t make_bakery_data(unsigned int choosing, unsigned int num)
 /*****************************************************************************
  * External bakery lock interface.
  ****************************************************************************/
-#if USE_COHERENT_MEM
+#if USE_TICKET_LOCK
+/*
+ * All participants are cache-coherent whenever they take a lock, so bakery
+ * locks are implemented as ticket locks. The lock is a single word in normal
+ * .bss memory, acquired in O(1) regardless of the number of CPUs, and
+ * contenders are granted the lock in FIFO order.
+ */
+#include <lib/ticket_lock.h>
+
+typedef ticketlock_t bakery_lock_t;
+
+#elif USE_COHERENT_MEM
 /*
  * Bakery locks are stored in coherent memory
  *
@@ -90,13 +102,36 @@ typedef struct bakery_info {
 
 typedef bakery_info_t bakery_lock_t;
 
-#endif /* __USE_COHERENT_MEM__ */
+#endif /* USE_TICKET_LOCK */
 
 static inline void bakery_lock_init(bakery_lock_t *bakery) {}
+
+#if USE_TICKET_LOCK
+static inline void bakery_lock_get(bakery_lock_t *bakery)
+{
+	uint64_t start = lock_stats_wait_start();
+	uint32_t val = bakery->lock;
+
+	/* Contended if the next ticket is not the one being served */
+	bool contended = (val >> 16) != (val & 0xFFFFU);
+
+	ticket_lock(bakery);
+	lock_stats_acquired(bakery, start, contended);
+}
+
+static inline void bakery_lock_release(bakery_lock_t *bakery)
+{
+	lock_stats_released(bakery);
+	ticket_unlock(bakery);
+}
+
+#define DEFINE_BAKERY_LOCK(_name) bakery_lock_t _name
+#else
 void bakery_lock_get(bakery_lock_t *bakery);
 void bakery_lock_release(bakery_lock_t *bakery);
 
 #define DEFINE_BAKERY_LOCK(_name) bakery_lock_t _name __section(".bakery_lock")
+#endif
 
 #define DECLARE_BAKERY_LOCK(_name) extern bakery_lock_t _name
 
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef BOOT_TIMING_H
+#define BOOT_TIMING_H
+
+#include <lib/utils_def.h>
+
+#include <platform_def.h>
+
+/* Boot stages recording timestamps */
+#define BOOT_TIMING_STAGE_BL1		U(1)
+#define BOOT_TIMING_STAGE_BL2		U(2)
+#define BOOT_TIMING_STAGE_BL31		U(3)
+#define BOOT_TIMING_STAGE_BL32		U(4)
+
+/*
+ * Boot milestones. Events which are not related to an image are recorded with
+ * INVALID_IMAGE_ID.
+ */
+#define BOOT_TIMING_EV_STAGE_ENTRY	U(1)
+#define BOOT_TIMING_EV_MMU_ENABLED	U(2)
+#define BOOT_TIMING_EV_LOAD_START	U(3)
+#define BOOT_TIMING_EV_LOAD_END		U(4)
+#define BOOT_TIMING_EV_AUTH_START	U(5)
+#define BOOT_TIMING_EV_AUTH_END		U(6)
+#define BOOT_TIMING_EV_DECOMP_START	U(7)
+#define BOOT_TIMING_EV_DECOMP_END	U(8)
+#define BOOT_TIMING_EV_HANDOFF		U(9)
+
+/* Maximum number of records kept for the whole boot */
+#ifdef PLAT_BOOT_TIMING_MAX_ENTRIES
+#define BOOT_TIMING_MAX_ENTRIES		PLAT_BOOT_TIMING_MAX_ENTRIES
+#else
+#define BOOT_TIMING_MAX_ENTRIES		U(64)
+#endif
+
+#define BOOT_TIMING_MAGIC		U(0x4d495442)	/* "BTIM" */
+
+/*
+ * Defines for boot timing SMC function ids, part of the SiP range.
+ */
+#define BOOT_TIMING_SMC_GET_INFO	U(0xC2000090)
+#define BOOT_TIMING_SMC_GET_ENTRY	U(0xC2000091)
+#define BOOT_TIMING_NUM_SMC_CALLS	2
+
+/* Error codes returned by the boot timing SMCs */
+#define BOOT_TIMING_E_SUCCESS		0
+#define BOOT_TIMING_E_INVALID_PARAMS	-2
+
+#ifndef __ASSEMBLER__
+
+#include <stdint.h>
+
+typedef struct boot_timing_entry {
+	uint64_t timestamp;
+	uint32_t image_id;
+	uint8_t stage;
+	uint8_t event;
+	uint16_t reserved;
+} boot_timing_entry_t;
+
+/*
+ * Records of the current and all the previous boot stages. Each stage owns a
+ * copy. On handoff, it copies it to PLAT_BOOT_TIMING_HANDOFF_BASE, if the
+ * platform defines it, and passes it to the next stage as a
+ * BL_AUX_PARAM_BOOT_TIMING auxiliary parameter pointing to the copy.
+ */
+typedef struct boot_timing_buf {
+	uint32_t magic;
+	uint32_t num_entries;
+	uint32_t dropped;
+	uint32_t reserved;
+	boot_timing_entry_t entries[BOOT_TIMING_MAX_ENTRIES];
+} boot_timing_buf_t;
+
+#if ENABLE_BOOT_TIMING
+void boot_timing_record(unsigned int event, unsigned int image_id);
+void boot_timing_inherit(uintptr_t prev_buf);
+uintptr_t boot_timing_get_aux_param(void);
+const boot_timing_buf_t *boot_timing_get_buf(void);
+uintptr_t boot_timing_smc_handler(unsigned int smc_fid,
+				  u_register_t x1,
+				  u_register_t x2,
+				  u_register_t x3,
+				  u_register_t x4,
+				  void *cookie,
+				  void *handle,
+				  u_register_t flags);
+
+#define BOOT_TIMING_RECORD(_ev, _image_id)	\
+	boot_timing_record((_ev), (_image_id))
+#else
+#define BOOT_TIMING_RECORD(_ev, _image_id)
+#endif /* ENABLE_BOOT_TIMING */
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* BOOT_TIMING_H */
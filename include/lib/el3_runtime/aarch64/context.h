@@ -65,13 +65,44 @@
 #define CTX_ZCR_EL3		U(0x40)
 #define CTX_EL3STATE_END	U(0x50) /* Align to the next 16 byte boundary */
 
+/*******************************************************************************
+ * Registers related to CVE-2018-3639
+ ******************************************************************************/
+#define CTX_CVE_2018_3639_OFFSET	(CTX_EL3STATE_OFFSET + CTX_EL3STATE_END)
+#if DYNAMIC_WORKAROUND_CVE_2018_3639
+#define CTX_CVE_2018_3639_DISABLE	U(0)
+#define CTX_CVE_2018_3639_END		U(0x10) /* Align to the next 16 byte boundary */
+#else
+#define CTX_CVE_2018_3639_END		U(0)
+#endif /* DYNAMIC_WORKAROUND_CVE_2018_3639 */
+
+/*******************************************************************************
+ * Registers related to ARMv8.3-PAuth.
+ ******************************************************************************/
+#define CTX_PAUTH_REGS_OFFSET	(CTX_CVE_2018_3639_OFFSET + CTX_CVE_2018_3639_END)
+#if CTX_INCLUDE_PAUTH_REGS
+#define CTX_PACIAKEY_LO		U(0x0)
+#define CTX_PACIAKEY_HI		U(0x8)
+#define CTX_PACIBKEY_LO		U(0x10)
+#define CTX_PACIBKEY_HI		U(0x18)
+#define CTX_PACDAKEY_LO		U(0x20)
+#define CTX_PACDAKEY_HI		U(0x28)
+#define CTX_PACDBKEY_LO		U(0x30)
+#define CTX_PACDBKEY_HI		U(0x38)
+#define CTX_PACGAKEY_LO		U(0x40)
+#define CTX_PACGAKEY_HI		U(0x48)
+#define CTX_PAUTH_REGS_END	U(0x50) /* Align to the next 16 byte boundary */
+#else
+#define CTX_PAUTH_REGS_END	U(0)
+#endif /* CTX_INCLUDE_PAUTH_REGS */
+
 /*******************************************************************************
  * Constants that allow assembler code to access members of and the
  * 'el1_sys_regs' structure at their correct offsets. Note that some of the
  * registers are only 32-bits wide but are stored as 64-bit values for
  * convenience
  ******************************************************************************/
-#define CTX_EL1_SYSREGS_OFFSET	(CTX_EL3STATE_OFFSET + CTX_EL3STATE_END)
+#define CTX_EL1_SYSREGS_OFFSET	(CTX_PAUTH_REGS_OFFSET + CTX_PAUTH_REGS_END)
 #define CTX_SPSR_EL1		U(0x0)
 #define CTX_ELR_EL1		U(0x8)
 #define CTX_SCTLR_EL1		U(0x10)
@@ -190,55 +221,144 @@
 #define CTX_VTCR_EL2		U(0xf0)
 #define CTX_VTTBR_EL2		U(0xf8)
 
-// Only if MTE registers in use
-#define CTX_TFSR_EL2		U(0x100)
-
-#define CTX_MPAM2_EL2		U(0x108)
-#define CTX_MPAMHCR_EL2		U(0x110)
-#define CTX_MPAMVPM0_EL2	U(0x118)
-#define CTX_MPAMVPM1_EL2	U(0x120)
-#define CTX_MPAMVPM2_EL2	U(0x128)
-#define CTX_MPAMVPM3_EL2	U(0x130)
-#define CTX_MPAMVPM4_EL2	U(0x138)
-#define CTX_MPAMVPM5_EL2	U(0x140)
-#define CTX_MPAMVPM6_EL2	U(0x148)
-#define CTX_MPAMVPM7_EL2	U(0x150)
-#define CTX_MPAMVPMV_EL2	U(0x158)
+#define CTX_EL2_COMMON_END	U(0x100)
+
+/*
+ * The registers below belong to optional architecture features. Space is only
+ * reserved for the features that the build can enable, each block starting
+ * where the previous one ended.
+ */
+#if CTX_INCLUDE_MTE_REGS
+#define CTX_TFSR_EL2		(CTX_EL2_COMMON_END + U(0x0))
+#define CTX_EL2_MTE_END		(CTX_EL2_COMMON_END + U(0x8))
+#else
+#define CTX_EL2_MTE_END		CTX_EL2_COMMON_END
+#endif /* CTX_INCLUDE_MTE_REGS */
+
+#if ENABLE_MPAM_FOR_LOWER_ELS
+#define CTX_MPAM2_EL2		(CTX_EL2_MTE_END + U(0x0))
+#define CTX_MPAMHCR_EL2		(CTX_EL2_MTE_END + U(0x8))
+#define CTX_MPAMVPM0_EL2	(CTX_EL2_MTE_END + U(0x10))
+#define CTX_MPAMVPM1_EL2	(CTX_EL2_MTE_END + U(0x18))
+#define CTX_MPAMVPM2_EL2	(CTX_EL2_MTE_END + U(0x20))
+#define CTX_MPAMVPM3_EL2	(CTX_EL2_MTE_END + U(0x28))
+#define CTX_MPAMVPM4_EL2	(CTX_EL2_MTE_END + U(0x30))
+#define CTX_MPAMVPM5_EL2	(CTX_EL2_MTE_END + U(0x38))
+#define CTX_MPAMVPM6_EL2	(CTX_EL2_MTE_END + U(0x40))
+#define CTX_MPAMVPM7_EL2	(CTX_EL2_MTE_END + U(0x48))
+#define CTX_MPAMVPMV_EL2	(CTX_EL2_MTE_END + U(0x50))
+#define CTX_EL2_MPAM_END	(CTX_EL2_MTE_END + U(0x58))
+#else
+#define CTX_EL2_MPAM_END	CTX_EL2_MTE_END
+#endif /* ENABLE_MPAM_FOR_LOWER_ELS */
 
 // Starting with Armv8.6
-#define CTX_HDFGRTR_EL2		U(0x160)
-#define CTX_HAFGRTR_EL2		U(0x168)
-#define CTX_HDFGWTR_EL2		U(0x170)
-#define CTX_HFGITR_EL2		U(0x178)
-#define CTX_HFGRTR_EL2		U(0x180)
-#define CTX_HFGWTR_EL2		U(0x188)
-#define CTX_CNTPOFF_EL2		U(0x190)
+#if ENABLE_FEAT_FGT
+#define CTX_HDFGRTR_EL2		(CTX_EL2_MPAM_END + U(0x0))
+#define CTX_HAFGRTR_EL2		(CTX_EL2_MPAM_END + U(0x8))
+#define CTX_HDFGWTR_EL2		(CTX_EL2_MPAM_END + U(0x10))
+#define CTX_HFGITR_EL2		(CTX_EL2_MPAM_END + U(0x18))
+#define CTX_HFGRTR_EL2		(CTX_EL2_MPAM_END + U(0x20))
+#define CTX_HFGWTR_EL2		(CTX_EL2_MPAM_END + U(0x28))
+#define CTX_EL2_FGT_END		(CTX_EL2_MPAM_END + U(0x30))
+#else
+#define CTX_EL2_FGT_END		CTX_EL2_MPAM_END
+#endif /* ENABLE_FEAT_FGT */
+
+#if ENABLE_FEAT_ECV
+#define CTX_CNTPOFF_EL2		(CTX_EL2_FGT_END + U(0x0))
+#define CTX_EL2_ECV_END		(CTX_EL2_FGT_END + U(0x8))
+#else
+#define CTX_EL2_ECV_END		CTX_EL2_FGT_END
+#endif /* ENABLE_FEAT_ECV */
 
 // Starting with Armv8.4
-#define CTX_CONTEXTIDR_EL2	U(0x198)
-#define CTX_TTBR1_EL2		U(0x1a0)
-#define CTX_VDISR_EL2		U(0x1a8)
-#define CTX_VSESR_EL2		U(0x1b0)
-#define CTX_VNCR_EL2		U(0x1b8)
-#define CTX_TRFCR_EL2		U(0x1c0)
+#if ENABLE_FEAT_VHE
+#define CTX_CONTEXTIDR_EL2	(CTX_EL2_ECV_END + U(0x0))
+#define CTX_TTBR1_EL2		(CTX_EL2_ECV_END + U(0x8))
+#define CTX_EL2_VHE_END		(CTX_EL2_ECV_END + U(0x10))
+#else
+#define CTX_EL2_VHE_END		CTX_EL2_ECV_END
+#endif /* ENABLE_FEAT_VHE */
+
+#if ENABLE_FEAT_RAS
+#define CTX_VDISR_EL2		(CTX_EL2_VHE_END + U(0x0))
+#define CTX_VSESR_EL2		(CTX_EL2_VHE_END + U(0x8))
+#define CTX_EL2_RAS_END		(CTX_EL2_VHE_END + U(0x10))
+#else
+#define CTX_EL2_RAS_END		CTX_EL2_VHE_END
+#endif /* ENABLE_FEAT_RAS */
+
+#if CTX_INCLUDE_NEVE_REGS
+#define CTX_VNCR_EL2		(CTX_EL2_RAS_END + U(0x0))
+#define CTX_EL2_NV2_END		(CTX_EL2_RAS_END + U(0x8))
+#else
+#define CTX_EL2_NV2_END		CTX_EL2_RAS_END
+#endif /* CTX_INCLUDE_NEVE_REGS */
+
+#if ENABLE_TRF_FOR_NS
+#define CTX_TRFCR_EL2		(CTX_EL2_NV2_END + U(0x0))
+#define CTX_EL2_TRF_END		(CTX_EL2_NV2_END + U(0x8))
+#else
+#define CTX_EL2_TRF_END		CTX_EL2_NV2_END
+#endif /* ENABLE_TRF_FOR_NS */
 
 // Starting with Armv8.5
-#define CTX_SCXTNUM_EL2		U(0x1c8)
+#if ENABLE_FEAT_CSV2_2
+#define CTX_SCXTNUM_EL2		(CTX_EL2_TRF_END + U(0x0))
+#define CTX_EL2_CSV2_2_END	(CTX_EL2_TRF_END + U(0x8))
+#else
+#define CTX_EL2_CSV2_2_END	CTX_EL2_TRF_END
+#endif /* ENABLE_FEAT_CSV2_2 */
 
 // Register for FEAT_HCX
-#define CTX_HCRX_EL2            U(0x1d0)
+#if ENABLE_FEAT_HCX
+#define CTX_HCRX_EL2		(CTX_EL2_CSV2_2_END + U(0x0))
+#define CTX_EL2_HCX_END		(CTX_EL2_CSV2_2_END + U(0x8))
+#else
+#define CTX_EL2_HCX_END		CTX_EL2_CSV2_2_END
+#endif /* ENABLE_FEAT_HCX */
 
 // Starting with Armv8.9
-#define CTX_TCR2_EL2            U(0x1d8)
-#define CTX_POR_EL2             U(0x1e0)
-#define CTX_PIRE0_EL2           U(0x1e8)
-#define CTX_PIR_EL2             U(0x1f0)
-#define CTX_S2PIR_EL2		U(0x1f8)
-#define CTX_GCSCR_EL2           U(0x200)
-#define CTX_GCSPR_EL2           U(0x208)
+#if ENABLE_FEAT_TCR2
+#define CTX_TCR2_EL2		(CTX_EL2_HCX_END + U(0x0))
+#define CTX_EL2_TCR2_END	(CTX_EL2_HCX_END + U(0x8))
+#else
+#define CTX_EL2_TCR2_END	CTX_EL2_HCX_END
+#endif /* ENABLE_FEAT_TCR2 */
+
+#if ENABLE_FEAT_S1PIE || ENABLE_FEAT_S2PIE
+#define CTX_PIRE0_EL2		(CTX_EL2_TCR2_END + U(0x0))
+#define CTX_PIR_EL2		(CTX_EL2_TCR2_END + U(0x8))
+#define CTX_EL2_SXPIE_END	(CTX_EL2_TCR2_END + U(0x10))
+#else
+#define CTX_EL2_SXPIE_END	CTX_EL2_TCR2_END
+#endif /* ENABLE_FEAT_S1PIE || ENABLE_FEAT_S2PIE */
+
+#if ENABLE_FEAT_S2PIE
+#define CTX_S2PIR_EL2		(CTX_EL2_SXPIE_END + U(0x0))
+#define CTX_EL2_S2PIE_END	(CTX_EL2_SXPIE_END + U(0x8))
+#else
+#define CTX_EL2_S2PIE_END	CTX_EL2_SXPIE_END
+#endif /* ENABLE_FEAT_S2PIE */
+
+#if ENABLE_FEAT_S1POE || ENABLE_FEAT_S2POE
+#define CTX_POR_EL2		(CTX_EL2_S2PIE_END + U(0x0))
+#define CTX_EL2_SXPOE_END	(CTX_EL2_S2PIE_END + U(0x8))
+#else
+#define CTX_EL2_SXPOE_END	CTX_EL2_S2PIE_END
+#endif /* ENABLE_FEAT_S1POE || ENABLE_FEAT_S2POE */
+
+#if ENABLE_FEAT_GCS
+#define CTX_GCSCR_EL2		(CTX_EL2_SXPOE_END + U(0x0))
+#define CTX_GCSPR_EL2		(CTX_EL2_SXPOE_END + U(0x8))
+#define CTX_EL2_GCS_END		(CTX_EL2_SXPOE_END + U(0x10))
+#else
+#define CTX_EL2_GCS_END		CTX_EL2_SXPOE_END
+#endif /* ENABLE_FEAT_GCS */
 
 /* Align to the next 16 byte boundary */
-#define CTX_EL2_SYSREGS_END	U(0x210)
+#define CTX_EL2_SYSREGS_END	((CTX_EL2_GCS_END + U(0xf)) & ~U(0xf))
 
 #endif /* CTX_INCLUDE_EL2_REGS */
 
@@ -296,33 +416,6 @@
 #define CTX_FPREGS_END		U(0)
 #endif
 
-/*******************************************************************************
- * Registers related to CVE-2018-3639
- ******************************************************************************/
-#define CTX_CVE_2018_3639_OFFSET	(CTX_FPREGS_OFFSET + CTX_FPREGS_END)
-#define CTX_CVE_2018_3639_DISABLE	U(0)
-#define CTX_CVE_2018_3639_END		U(0x10) /* Align to the next 16 byte boundary */
-
-/*******************************************************************************
- * Registers related to ARMv8.3-PAuth.
- ******************************************************************************/
-#define CTX_PAUTH_REGS_OFFSET	(CTX_CVE_2018_3639_OFFSET + CTX_CVE_2018_3639_END)
-#if CTX_INCLUDE_PAUTH_REGS
-#define CTX_PACIAKEY_LO		U(0x0)
-#define CTX_PACIAKEY_HI		U(0x8)
-#define CTX_PACIBKEY_LO		U(0x10)
-#define CTX_PACIBKEY_HI		U(0x18)
-#define CTX_PACDAKEY_LO		U(0x20)
-#define CTX_PACDAKEY_HI		U(0x28)
-#define CTX_PACDBKEY_LO		U(0x30)
-#define CTX_PACDBKEY_HI		U(0x38)
-#define CTX_PACGAKEY_LO		U(0x40)
-#define CTX_PACGAKEY_HI		U(0x48)
-#define CTX_PAUTH_REGS_END	U(0x50) /* Align to the next 16 byte boundary */
-#else
-#define CTX_PAUTH_REGS_END	U(0)
-#endif /* CTX_INCLUDE_PAUTH_REGS */
-
 #ifndef __ASSEMBLER__
 
 #include <stdint.h>
@@ -349,7 +442,9 @@
 # define CTX_FPREG_ALL		(CTX_FPREGS_END >> DWORD_SHIFT)
 #endif
 #define CTX_EL3STATE_ALL	(CTX_EL3STATE_END >> DWORD_SHIFT)
-#define CTX_CVE_2018_3639_ALL	(CTX_CVE_2018_3639_END >> DWORD_SHIFT)
+#if DYNAMIC_WORKAROUND_CVE_2018_3639
+# define CTX_CVE_2018_3639_ALL	(CTX_CVE_2018_3639_END >> DWORD_SHIFT)
+#endif
 #if CTX_INCLUDE_PAUTH_REGS
 # define CTX_PAUTH_REGS_ALL	(CTX_PAUTH_REGS_END >> DWORD_SHIFT)
 #endif
@@ -394,7 +489,9 @@ DEFINE_REG_STRUCT(fp_regs, CTX_FPREG_ALL);
 DEFINE_REG_STRUCT(el3_state, CTX_EL3STATE_ALL);
 
 /* Function pointer used by CVE-2018-3639 dynamic mitigation */
+#if DYNAMIC_WORKAROUND_CVE_2018_3639
 DEFINE_REG_STRUCT(cve_2018_3639, CTX_CVE_2018_3639_ALL);
+#endif
 
 /* Registers associated to ARMv8.3-PAuth */
 #if CTX_INCLUDE_PAUTH_REGS
@@ -416,20 +513,26 @@ DEFINE_REG_STRUCT(pauth, CTX_PAUTH_REGS_ALL);
  * state. The context management library will be used to ensure that
  * SP_EL3 always points to an instance of this structure at exception
  * entry and exit.
+ *
+ * Only the members enabled by the build are present. The ones accessed on
+ * every exception entry and exit come first so that they share as few cache
+ * lines as possible, followed by those only switched on a change of world.
  */
 typedef struct cpu_context {
 	gp_regs_t gpregs_ctx;
 	el3_state_t el3state_ctx;
+#if DYNAMIC_WORKAROUND_CVE_2018_3639
+	cve_2018_3639_t cve_2018_3639_ctx;
+#endif
+#if CTX_INCLUDE_PAUTH_REGS
+	pauth_t pauth_ctx;
+#endif
 	el1_sysregs_t el1_sysregs_ctx;
 #if CTX_INCLUDE_EL2_REGS
 	el2_sysregs_t el2_sysregs_ctx;
 #endif
 #if CTX_INCLUDE_FPREGS
 	fp_regs_t fpregs_ctx;
-#endif
-	cve_2018_3639_t cve_2018_3639_ctx;
-#if CTX_INCLUDE_PAUTH_REGS
-	pauth_t pauth_ctx;
 #endif
 } cpu_context_t;
 
@@ -443,7 +546,9 @@ typedef struct cpu_context {
 # define get_el2_sysregs_ctx(h)	(&((cpu_context_t *) h)->el2_sysregs_ctx)
 #endif
 #define get_gpregs_ctx(h)	(&((cpu_context_t *) h)->gpregs_ctx)
-#define get_cve_2018_3639_ctx(h)	(&((cpu_context_t *) h)->cve_2018_3639_ctx)
+#if DYNAMIC_WORKAROUND_CVE_2018_3639
+# define get_cve_2018_3639_ctx(h)	(&((cpu_context_t *) h)->cve_2018_3639_ctx)
+#endif
 #if CTX_INCLUDE_PAUTH_REGS
 # define get_pauth_ctx(h)	(&((cpu_context_t *) h)->pauth_ctx)
 #endif
@@ -467,8 +572,10 @@ CASSERT(CTX_FPREGS_OFFSET == __builtin_offsetof(cpu_context_t, fpregs_ctx),
 #endif
 CASSERT(CTX_EL3STATE_OFFSET == __builtin_offsetof(cpu_context_t, el3state_ctx),
 	assert_core_context_el3state_offset_mismatch);
+#if DYNAMIC_WORKAROUND_CVE_2018_3639
 CASSERT(CTX_CVE_2018_3639_OFFSET == __builtin_offsetof(cpu_context_t, cve_2018_3639_ctx),
 	assert_core_context_cve_2018_3639_offset_mismatch);
+#endif
 #if CTX_INCLUDE_PAUTH_REGS
 CASSERT(CTX_PAUTH_REGS_OFFSET == __builtin_offsetof(cpu_context_t, pauth_ctx),
 	assert_core_context_pauth_offset_mismatch);
@@ -44,6 +44,16 @@ void cm_el2_sysregs_context_restore(uint32_t security_state);
 
 void cm_el1_sysregs_context_save(uint32_t security_state);
 void cm_el1_sysregs_context_restore(uint32_t security_state);
+
+#if CTX_INCLUDE_FPREGS
+void cm_fpregs_context_save(uint32_t security_state);
+void cm_fpregs_context_restore(uint32_t security_state);
+#if CTX_LAZY_FPREGS
+int cm_fpregs_lazy_trap(cpu_context_t *ctx);
+void cm_fpregs_lazy_reset(void);
+#endif
+#endif
+
 void cm_set_elr_el3(uint32_t security_state, uintptr_t entrypoint);
 void cm_set_elr_spsr_el3(uint32_t security_state,
 			uintptr_t entrypoint, uint32_t spsr);
@@ -17,6 +17,12 @@
  */
 REGISTER_PUBSUB_EVENT(psci_cpu_on_finish);
 
+/*
+ * Event published once a CPU has committed to powering down via the PSCI
+ * CPU OFF API, after the Secure Payload Dispatcher has been notified.
+ */
+REGISTER_PUBSUB_EVENT(psci_cpu_off_start);
+
 /*
  * These events are published before/after a CPU has been powered down/up
  * via the PSCI CPU SUSPEND API.
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef EL3_TRACE_H
+#define EL3_TRACE_H
+
+#include <lib/utils_def.h>
+
+/* Tracepoints are only compiled into BL31 */
+#if ENABLE_EL3_TRACE && defined(IMAGE_BL31)
+#define EL3_TRACE_ENABLED	1
+#else
+#define EL3_TRACE_ENABLED	0
+#endif
+
+/*
+ * Trace event identifiers. The meaning of the arguments of each event is:
+ *
+ *                          arg0            arg1            arg2
+ * SMC_ENTRY                function ID     flags           x1
+ * SMC_EXIT                 function ID     -               -
+ * WORLD_SWITCH             security state  -               -
+ * PSCI_PWR_DOWN            end power level is suspend      -
+ * PSCI_WARMBOOT            -               -               -
+ * EHF_ACTIVATE             priority        previous mask   -
+ * EHF_DEACTIVATE           priority        previous mask   -
+ * INTR_ACK                 raw interrupt   -               -
+ */
+#define EL3_TRACE_EV_SMC_ENTRY		U(1)
+#define EL3_TRACE_EV_SMC_EXIT		U(2)
+#define EL3_TRACE_EV_WORLD_SWITCH	U(3)
+#define EL3_TRACE_EV_PSCI_PWR_DOWN	U(4)
+#define EL3_TRACE_EV_PSCI_WARMBOOT	U(5)
+#define EL3_TRACE_EV_EHF_ACTIVATE	U(6)
+#define EL3_TRACE_EV_EHF_DEACTIVATE	U(7)
+#define EL3_TRACE_EV_INTR_ACK		U(8)
+
+/* Bit in the event mask enabling a given event */
+#define EL3_TRACE_EVENT_BIT(_ev)	(ULL(1) << (_ev))
+
+/*
+ * Layout of the shared trace buffer provided by the Non-secure world. The
+ * buffer starts with an el3_trace_hdr_t, followed by one ring per CPU. Each
+ * ring starts with an el3_trace_ring_hdr_t on its own cache line, followed by
+ * 'entries_per_cpu' el3_trace_entry_t.
+ */
+#define EL3_TRACE_MAGIC			U(0x54334c45)	/* "EL3T" */
+#define EL3_TRACE_VERSION		U(1)
+#define EL3_TRACE_HDR_SIZE		U(64)
+
+/*
+ * Defines for EL3 trace SMC function ids, part of the SiP range.
+ */
+#define EL3_TRACE_SMC_SETUP		U(0xC2000080)
+#define EL3_TRACE_SMC_CONTROL		U(0xC2000081)
+#define EL3_TRACE_SMC_GET_INFO		U(0xC2000082)
+#define EL3_TRACE_NUM_SMC_CALLS		3
+
+/* Error codes returned by the EL3 trace SMCs */
+#define EL3_TRACE_E_SUCCESS		0
+#define EL3_TRACE_E_NOT_SUPPORTED	-1
+#define EL3_TRACE_E_INVALID_PARAMS	-2
+#define EL3_TRACE_E_DENIED		-3
+#define EL3_TRACE_E_NO_MEMORY		-5
+
+#ifndef __ASSEMBLER__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct el3_trace_hdr {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t num_cpus;
+	uint32_t entries_per_cpu;
+	uint32_t entry_size;
+	uint64_t counter_freq;
+	/* Offset of the ring of CPU 0 from the start of the buffer */
+	uint64_t ring_offset;
+	/* Distance between the rings of consecutive CPUs */
+	uint64_t ring_stride;
+} el3_trace_hdr_t;
+
+typedef struct el3_trace_ring_hdr {
+	/*
+	 * Number of entries ever written to the ring. The entry for a given
+	 * count is at index (count % entries_per_cpu). It is updated with
+	 * release semantics after the entry has been written.
+	 */
+	volatile uint64_t head;
+} el3_trace_ring_hdr_t;
+
+typedef struct el3_trace_entry {
+	uint64_t timestamp;
+	uint16_t event;
+	uint16_t cpu;
+	uint32_t arg0;
+	uint64_t arg1;
+	uint64_t arg2;
+} el3_trace_entry_t;
+
+#if EL3_TRACE_ENABLED
+/* Mask of the enabled events, zero when tracing is stopped */
+extern uint64_t el3_trace_events;
+
+void el3_trace_record(unsigned int event, uint32_t arg0, uint64_t arg1,
+		      uint64_t arg2);
+int el3_trace_setup(uint64_t base_pa, size_t size);
+int el3_trace_control(uint64_t events);
+void el3_trace_get_info(size_t *size, uint32_t *entries_per_cpu);
+uintptr_t el3_trace_smc_handler(unsigned int smc_fid,
+				u_register_t x1,
+				u_register_t x2,
+				u_register_t x3,
+				u_register_t x4,
+				void *cookie,
+				void *handle,
+				u_register_t flags);
+
+/* Tracepoint. Costs a load and a branch when the event is disabled. */
+#define EL3_TRACE(_ev, _arg0, _arg1, _arg2)				\
+	do {								\
+		if ((el3_trace_events & EL3_TRACE_EVENT_BIT(_ev)) != 0ULL) { \
+			el3_trace_record((_ev), (uint32_t)(_arg0),	\
+					 (uint64_t)(_arg1),		\
+					 (uint64_t)(_arg2));		\
+		}							\
+	} while (false)
+#else
+#define EL3_TRACE(_ev, _arg0, _arg1, _arg2)	do { } while (false)
+#endif /* EL3_TRACE_ENABLED */
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* EL3_TRACE_H */
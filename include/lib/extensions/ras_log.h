@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef RAS_LOG_H
+#define RAS_LOG_H
+
+#include <lib/utils_def.h>
+
+/*
+ * Defines for RAS error log SMC function ids, part of the SiP range.
+ */
+#define RAS_LOG_SMC_GET_INFO		U(0xC20000C0)
+#define RAS_LOG_SMC_SET_BATCH		U(0xC20000C1)
+#define RAS_LOG_NUM_SMC_CALLS		2
+
+/* Error codes returned by the RAS error log SMCs */
+#define RAS_LOG_E_SUCCESS		0
+#define RAS_LOG_E_INVALID_PARAMS	-2
+
+/* Identification of the shared ring */
+#define RAS_LOG_MAGIC			U(0x4c534152)	/* "RASL" */
+#define RAS_LOG_VERSION			U(1)
+
+/* Error severities, with the values used by UEFI CPER */
+#define RAS_LOG_SEV_RECOVERABLE		U(0)
+#define RAS_LOG_SEV_FATAL		U(1)
+#define RAS_LOG_SEV_CORRECTED		U(2)
+#define RAS_LOG_SEV_INFORMATIONAL	U(3)
+
+/* Entry flags */
+#define RAS_LOG_FLAG_MEMMAP		BIT_32(0)	/* Memory-mapped record */
+#define RAS_LOG_FLAG_ADDR_VALID		BIT_32(1)	/* 'addr' is valid */
+#define RAS_LOG_FLAG_MISC_VALID		BIT_32(2)	/* 'misc0' is valid */
+
+#ifndef __ASSEMBLER__
+
+#include <stdint.h>
+
+#include <lib/cassert.h>
+#include <lib/extensions/ras.h>
+
+/*
+ * Header of the ring shared with the Non-secure world. It is followed by
+ * 'num_entries' entries. Entry number 'n' is held in slot 'n % num_entries'.
+ *
+ * EL3 fills the entries, then advances 'head'. The consumer reads the entries
+ * from 'tail' to 'head', then advances 'tail'. New entries are dropped while
+ * the ring is full.
+ */
+struct ras_log_header {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t entry_size;
+	uint32_t num_entries;
+	uint32_t reserved;
+
+	/* Number of entries produced, only written by EL3 */
+	uint64_t head;
+
+	/* Number of entries consumed, only written by the consumer */
+	uint64_t tail;
+
+	/* Number of entries dropped because the ring was full */
+	uint64_t dropped;
+	uint64_t reserved1;
+};
+
+/*
+ * Compact record of one error, modelled on the CPER ARM processor error
+ * section. All fields are captured from the Standard Error Record in error.
+ */
+struct ras_log_entry {
+	/* Low 32 bits of the number of the entry */
+	uint32_t seq;
+
+	/* One of the RAS_LOG_SEV_* constants */
+	uint8_t severity;
+
+	/* How the error was signalled, one of the ERROR_* constants */
+	uint8_t reason;
+
+	/* RAS_LOG_FLAG_* */
+	uint16_t flags;
+
+	/* Index of the record in error within its group */
+	uint32_t record;
+
+	/* Raw interrupt ID for interrupts, syndrome for External Aborts */
+	uint32_t cause;
+
+	/* PE that handled the error, and system counter value at the time */
+	uint64_t mpidr;
+	uint64_t timestamp;
+
+	/*
+	 * Base address of the memory-mapped record group, or index of the
+	 * first System register record of the group.
+	 */
+	uint64_t node;
+
+	/* ERR<n>STATUS, ERR<n>ADDR and ERR<n>MISC0 */
+	uint64_t status;
+	uint64_t addr;
+	uint64_t misc0;
+};
+
+CASSERT(sizeof(struct ras_log_header) == 48U, assert_ras_log_header_size);
+CASSERT(sizeof(struct ras_log_entry) == 64U, assert_ras_log_entry_size);
+
+void ras_log_init(void);
+uint64_t ras_log_ser(const struct err_record_info *info, int probe_data,
+		const struct err_handler_data *const data);
+void ras_log_notify(void);
+uintptr_t ras_log_smc_handler(unsigned int smc_fid,
+			      u_register_t x1,
+			      u_register_t x2,
+			      u_register_t x3,
+			      u_register_t x4,
+			      void *cookie,
+			      void *handle,
+			      u_register_t flags);
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* RAS_LOG_H */
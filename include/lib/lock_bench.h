@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef LOCK_BENCH_H
+#define LOCK_BENCH_H
+
+#include <lib/utils_def.h>
+
+/*
+ * Defines for lock benchmark SMC function ids, part of the SiP range.
+ */
+#define LOCK_BENCH_SMC_RUN		U(0xC20000D0)
+#define LOCK_BENCH_NUM_SMC_CALLS	1
+
+/* Locks that LOCK_BENCH_SMC_RUN can exercise */
+#define LOCK_BENCH_LOCK_BAKERY		U(0)
+#define LOCK_BENCH_LOCK_SPIN		U(1)
+
+/*
+ * Bounds of the number of acquisitions and of the hold time, in system counter
+ * ticks, of one call. They bound the time spent in EL3 with interrupts masked.
+ */
+#define LOCK_BENCH_MAX_ITERATIONS	U(0x10000)
+#define LOCK_BENCH_MAX_HOLD_TICKS	U(0x1000)
+
+/* Error codes returned by the lock benchmark SMCs */
+#define LOCK_BENCH_E_SUCCESS		0
+#define LOCK_BENCH_E_INVALID_PARAMS	-2
+
+#ifndef __ASSEMBLER__
+
+#include <stdint.h>
+
+uintptr_t lock_bench_smc_handler(unsigned int smc_fid,
+				 u_register_t x1,
+				 u_register_t x2,
+				 u_register_t x3,
+				 u_register_t x4,
+				 void *cookie,
+				 void *handle,
+				 u_register_t flags);
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* LOCK_BENCH_H */
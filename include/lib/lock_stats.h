@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef LOCK_STATS_H
+#define LOCK_STATS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <lib/utils_def.h>
+
+/*
+ * Lock statistics are only collected in BL31, where all the runtime locks
+ * are taken.
+ */
+#if ENABLE_LOCK_STATS && defined(IMAGE_BL31)
+#define LOCK_STATS_ENABLED	1
+#else
+#define LOCK_STATS_ENABLED	0
+#endif
+
+/* Maximum number of distinct locks tracked */
+#ifdef PLAT_LOCK_STATS_MAX_LOCKS
+#define LOCK_STATS_MAX_LOCKS	PLAT_LOCK_STATS_MAX_LOCKS
+#else
+#define LOCK_STATS_MAX_LOCKS	U(32)
+#endif
+
+/*
+ * Defines for lock statistics SMC function ids, part of the SiP range.
+ */
+#define LOCK_STATS_SMC_GET_NUM_LOCKS	U(0xC2000060)
+#define LOCK_STATS_SMC_GET_NAME		U(0xC2000061)
+#define LOCK_STATS_SMC_GET_STATS	U(0xC2000062)
+#define LOCK_STATS_SMC_RESET		U(0xC2000063)
+#define LOCK_STATS_NUM_SMC_CALLS	4
+
+/* Error codes returned by the lock statistics SMCs */
+#define LOCK_STATS_E_SUCCESS		0
+#define LOCK_STATS_E_INVALID_PARAMS	-2
+
+/*
+ * Statistics kept for a single lock. All times are in system counter
+ * (CNTPCT_EL0) ticks. The fields are only updated by the holder of the lock
+ * they describe, so the lock itself serialises the updates.
+ */
+typedef struct lock_stats {
+	const void *lock;
+	const char *name;
+	uint64_t acquire_count;
+	uint64_t contended_count;
+	uint64_t wait_total;
+	uint64_t wait_max;
+	uint64_t hold_total;
+	uint64_t hold_max;
+	/* Time at which the current holder acquired the lock */
+	uint64_t hold_start;
+} lock_stats_t;
+
+#if LOCK_STATS_ENABLED
+uint64_t lock_stats_wait_start(void);
+void lock_stats_register(const void *lock, const char *name);
+void lock_stats_acquired(const void *lock, uint64_t wait_start,
+			 bool contended);
+void lock_stats_released(const void *lock);
+unsigned int lock_stats_get_num_locks(void);
+const lock_stats_t *lock_stats_get(unsigned int idx);
+void lock_stats_reset(void);
+uintptr_t lock_stats_smc_handler(unsigned int smc_fid,
+				 u_register_t x1,
+				 u_register_t x2,
+				 u_register_t x3,
+				 u_register_t x4,
+				 void *cookie,
+				 void *handle,
+				 u_register_t flags);
+#else
+static inline uint64_t lock_stats_wait_start(void)
+{
+	return 0ULL;
+}
+
+static inline void lock_stats_register(const void *lock, const char *name)
+{
+}
+
+static inline void lock_stats_acquired(const void *lock, uint64_t wait_start,
+				       bool contended)
+{
+}
+
+static inline void lock_stats_released(const void *lock)
+{
+}
+#endif /* LOCK_STATS_ENABLED */
+
+#endif /* LOCK_STATS_H */
@@ -91,6 +91,9 @@ void psci_prepare_next_non_secure_ctx(
 			  entry_point_info_t *next_image_info);
 int psci_stop_other_cores(unsigned int wait_ms,
 			  void (*stop_func)(u_register_t mpidr));
+int psci_stop_other_cores_multi(unsigned int wait_ms,
+			  void (*stop_func)(const u_register_t *mpidrs,
+					    unsigned int num_mpidrs));
 bool psci_is_last_on_cpu_safe(void);
 bool psci_are_all_cpus_on_safe(void);
 void psci_pwrdown_cpu(unsigned int power_level);
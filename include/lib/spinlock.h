@@ -9,14 +9,30 @@
 
 #ifndef __ASSEMBLER__
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#include <lib/lock_stats.h>
+
 typedef struct spinlock {
 	volatile uint32_t lock;
 } spinlock_t;
 
 void spin_lock(spinlock_t *lock);
 void spin_unlock(spinlock_t *lock);
+bool spin_trylock(spinlock_t *lock);
+
+#if LOCK_STATS_ENABLED
+/*
+ * Route C callers through the instrumented variants. Assembly callers, such
+ * as the crash console helpers, keep using the raw lock functions.
+ */
+void lock_stats_spin_lock(spinlock_t *lock);
+void lock_stats_spin_unlock(spinlock_t *lock);
+
+#define spin_lock(_lock)	lock_stats_spin_lock(_lock)
+#define spin_unlock(_lock)	lock_stats_spin_unlock(_lock)
+#endif /* LOCK_STATS_ENABLED */
 
 #else
 
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef TICKET_LOCK_H
+#define TICKET_LOCK_H
+
+#ifndef __ASSEMBLER__
+
+#include <stdint.h>
+
+/*
+ * Ticket lock. Bits[15:0] hold the ticket currently being served and
+ * bits[31:16] the next ticket to be handed out. Contenders are granted the
+ * lock in the order in which they drew their ticket.
+ */
+typedef struct ticketlock {
+	volatile uint32_t lock;
+} ticketlock_t;
+
+void ticket_lock(ticketlock_t *lock);
+void ticket_unlock(ticketlock_t *lock);
+
+#else
+
+/* Ticket lock definitions for use in assembly */
+#define TICKETLOCK_ASM_ALIGN	2
+#define TICKETLOCK_ASM_SIZE	4
+
+#endif
+
+#endif /* TICKET_LOCK_H */
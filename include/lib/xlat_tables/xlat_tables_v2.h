@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -14,6 +14,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <lib/spinlock.h>
 #include <lib/xlat_tables/xlat_mmu_helpers.h>
 
 /*
@@ -337,6 +338,13 @@ int mmap_remove_dynamic_region_ctx(xlat_ctx_t *ctx,
 				uintptr_t base_va,
 				size_t size);
 
+/*
+ * The functions above do no locking. Callers that add or remove dynamic regions
+ * of the default translation context at runtime, where other CPUs may do the
+ * same, must hold this lock around the calls and the use of the region.
+ */
+extern spinlock_t mmap_dynamic_region_lock;
+
 #endif /* PLAT_XLAT_TABLES_DYNAMIC */
 
 /*
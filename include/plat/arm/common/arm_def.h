@@ -535,11 +535,26 @@ MEASURED_BOOT
 #define ARM_BL2_MEM_DESC_LIMIT		(ARM_BL2_MEM_DESC_BASE \
 					+ (PAGE_SIZE / 2U))
 
+/*
+ * The boot timing records of BL1 and BL2 are handed over to BL31 in a page of
+ * their own after the boot parameters, as the .bss of BL31 may overlap the
+ * memory of BL2.
+ */
+#if ENABLE_BOOT_TIMING
+#define ARM_BOOT_TIMING_BASE		(ARM_BL_RAM_BASE + (PAGE_SIZE * 2))
+#define ARM_BOOT_TIMING_SIZE		(PAGE_SIZE)
+#define PLAT_BOOT_TIMING_HANDOFF_BASE	ARM_BOOT_TIMING_BASE
+#define PLAT_BOOT_TIMING_HANDOFF_SIZE	ARM_BOOT_TIMING_SIZE
+#else
+#define ARM_BOOT_TIMING_SIZE		U(0)
+#endif
+
 /*
  * Define limit of firmware configuration memory:
- * ARM_FW_CONFIG + ARM_BL2_MEM_DESC memory
+ * ARM_FW_CONFIG + ARM_BL2_MEM_DESC + ARM_BOOT_TIMING memory
  */
-#define ARM_FW_CONFIGS_LIMIT		(ARM_BL_RAM_BASE + (PAGE_SIZE * 2))
+#define ARM_FW_CONFIGS_LIMIT		(ARM_BL_RAM_BASE + (PAGE_SIZE * 2) + \
+					 ARM_BOOT_TIMING_SIZE)
 
 #if ENABLE_RME
 /*
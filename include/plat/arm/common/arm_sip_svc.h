@@ -31,6 +31,52 @@
  * 0x82000050-0x8200005F
  */
 
+/*
+ * The EL3 diagnostic services below are only available to the Non-secure
+ * world. Calls from the Secure world return ARM_SIP_SVC_E_DENIED.
+ */
+#define ARM_SIP_SVC_E_DENIED		-3
+
+/*
+ * EL3 lock statistics SMC function IDs
+ * 0xC2000060-0xC200006F
+ */
+
+/*
+ * SMC EL3 residency statistics SMC function IDs
+ * 0xC2000070-0xC200007F
+ */
+
+/*
+ * EL3 trace SMC function IDs
+ * 0xC2000080-0xC200008F
+ */
+
+/*
+ * Boot timing SMC function IDs
+ * 0xC2000090-0xC200009F
+ */
+
+/*
+ * EHF priority level statistics SMC function IDs
+ * 0xC20000A0-0xC20000AF
+ */
+
+/*
+ * TRNG DRBG SMC function IDs
+ * 0xC20000B0-0xC20000BF
+ */
+
+/*
+ * RAS error log SMC function IDs
+ * 0xC20000C0-0xC20000CF
+ */
+
+/*
+ * EL3 lock benchmark SMC function IDs
+ * 0xC20000D0-0xC20000DF
+ */
+
 /* ARM SiP Service Calls version numbers */
 #define ARM_SIP_SVC_VERSION_MAJOR		U(0x0)
 #define ARM_SIP_SVC_VERSION_MINOR		U(0x2)
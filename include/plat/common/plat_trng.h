@@ -7,6 +7,9 @@
 #ifndef PLAT_TRNG_H
 #define PLAT_TRNG_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <tools_share/uuid.h>
 
 /* TRNG platform functions */
@@ -14,5 +17,6 @@
 extern uuid_t plat_trng_uuid;
 void plat_entropy_setup(void);
 bool plat_get_entropy(uint64_t *out);
+int plat_trng_drbg_validate_ns_buffer(uintptr_t base, size_t size);
 
 #endif /* PLAT_TRNG_H */
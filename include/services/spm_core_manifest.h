@@ -48,6 +48,15 @@ typedef struct spm_core_manifest_sect_attribute {
 	 */
 	uint16_t spmc_id;
 
+	/*
+	 * The SPMC saves and restores the EL1 system registers around any
+	 * execution at S-EL1 it performs while handling an FF-A direct message,
+	 * so the Non-secure EL1 context survives the round trip (optional).
+	 * - 0: not preserved (default)
+	 * - 1: preserved
+	 */
+	uint32_t el1_ctx_preserved;
+
 } spmc_manifest_attribute_t;
 
 #endif /* SPM_CORE_MANIFEST_H */
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef TRNG_DRBG_H
+#define TRNG_DRBG_H
+
+#include <lib/utils_def.h>
+
+/*
+ * Defines for TRNG DRBG SMC function ids, part of the SiP range.
+ */
+#define TRNG_DRBG_SMC_GET_INFO		U(0xC20000B0)
+#define TRNG_DRBG_SMC_GENERATE		U(0xC20000B1)
+#define TRNG_DRBG_NUM_SMC_CALLS		2
+
+/* Error codes returned by the TRNG DRBG SMCs */
+#define TRNG_DRBG_E_SUCCESS		0
+#define TRNG_DRBG_E_INVALID_PARAMS	-2
+#define TRNG_DRBG_E_DENIED		-3
+#define TRNG_DRBG_E_NO_ENTROPY		-4
+
+#ifndef __ASSEMBLER__
+
+#include <stdint.h>
+
+uintptr_t trng_drbg_smc_handler(unsigned int smc_fid,
+				u_register_t x1,
+				u_register_t x2,
+				u_register_t x3,
+				u_register_t x4,
+				void *cookie,
+				void *handle,
+				u_register_t flags);
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* TRNG_DRBG_H */
@@ -7,6 +7,7 @@
 #include <stdint.h>
 
 #include <common/debug.h>
+#include <lib/boot_timing.h>
 #include <lib/coreboot.h>
 #include <lib/bl_aux_params/bl_aux_params.h>
 
@@ -25,6 +26,12 @@ void bl_aux_params_parse(u_register_t head,
 			coreboot_table_setup((void *)(uintptr_t)
 				((struct bl_aux_param_uint64 *)p)->value);
 			break;
+#endif
+#if ENABLE_BOOT_TIMING
+		case BL_AUX_PARAM_BOOT_TIMING:
+			boot_timing_inherit((uintptr_t)
+				((struct bl_aux_param_uint64 *)p)->value);
+			break;
 #endif
 		default:
 			ERROR("Ignoring unknown BL aux parameter: 0x%" PRIx64,
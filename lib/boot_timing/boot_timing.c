@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <lib/bl_aux_params/bl_aux_params.h>
+#include <lib/boot_timing.h>
+#include <lib/cassert.h>
+
+#if defined(IMAGE_BL1)
+#define BOOT_TIMING_STAGE	BOOT_TIMING_STAGE_BL1
+#elif defined(IMAGE_BL2)
+#define BOOT_TIMING_STAGE	BOOT_TIMING_STAGE_BL2
+#elif defined(IMAGE_BL31)
+#define BOOT_TIMING_STAGE	BOOT_TIMING_STAGE_BL31
+#elif defined(IMAGE_BL32)
+#define BOOT_TIMING_STAGE	BOOT_TIMING_STAGE_BL32
+#else
+#define BOOT_TIMING_STAGE	U(0)
+#endif
+
+static boot_timing_buf_t boot_timing_buf = {
+	.magic = BOOT_TIMING_MAGIC,
+};
+
+/*
+ * Copy of the records passed to the next stage, with the auxiliary parameter
+ * pointing to it. The next stage reads it during its early platform setup,
+ * after it has zeroed its own .bss, which may overlap the memory of this
+ * stage. A platform where this happens must provide a handoff area that the
+ * next stage does not reclaim.
+ */
+typedef struct boot_timing_handoff {
+	struct bl_aux_param_uint64 param;
+	boot_timing_buf_t buf;
+} boot_timing_handoff_t;
+
+#ifdef PLAT_BOOT_TIMING_HANDOFF_BASE
+CASSERT(sizeof(boot_timing_handoff_t) <= PLAT_BOOT_TIMING_HANDOFF_SIZE,
+	assert_boot_timing_handoff_size);
+
+static boot_timing_handoff_t *const boot_timing_handoff =
+	(boot_timing_handoff_t *)PLAT_BOOT_TIMING_HANDOFF_BASE;
+#else
+static boot_timing_handoff_t boot_timing_handoff_data;
+static boot_timing_handoff_t *const boot_timing_handoff =
+	&boot_timing_handoff_data;
+#endif
+
+/*******************************************************************************
+ * Record a boot milestone of the current stage. Records are dropped once the
+ * buffer is full. On handoff, the records are copied to the handoff area and
+ * cleaned to memory, as the next stage reads them before enabling its MMU.
+ ******************************************************************************/
+void boot_timing_record(unsigned int event, unsigned int image_id)
+{
+	boot_timing_entry_t *entry;
+
+	if (boot_timing_buf.num_entries >= BOOT_TIMING_MAX_ENTRIES) {
+		boot_timing_buf.dropped++;
+		return;
+	}
+
+	entry = &boot_timing_buf.entries[boot_timing_buf.num_entries];
+	entry->timestamp = read_cntpct_el0();
+	entry->image_id = image_id;
+	entry->stage = (uint8_t)BOOT_TIMING_STAGE;
+	entry->event = (uint8_t)event;
+	entry->reserved = 0U;
+	boot_timing_buf.num_entries++;
+
+	if (event == BOOT_TIMING_EV_HANDOFF) {
+		(void)memcpy(&boot_timing_handoff->buf, &boot_timing_buf,
+			     sizeof(boot_timing_buf));
+		flush_dcache_range((uintptr_t)boot_timing_handoff,
+				   sizeof(*boot_timing_handoff));
+	}
+}
+
+/*******************************************************************************
+ * Prepend the records of the previous stages, passed in 'prev_buf', to the
+ * records of this stage. This must be called before the memory of the previous
+ * stage can be reused.
+ ******************************************************************************/
+void boot_timing_inherit(uintptr_t prev_buf)
+{
+	const boot_timing_buf_t *prev = (const boot_timing_buf_t *)prev_buf;
+	unsigned int num_prev, num_own;
+
+	if ((prev == NULL) || (prev->magic != BOOT_TIMING_MAGIC)) {
+		WARN("Ignoring invalid boot timing records\n");
+		return;
+	}
+
+	num_own = boot_timing_buf.num_entries;
+	num_prev = prev->num_entries;
+	if (num_prev > (BOOT_TIMING_MAX_ENTRIES - num_own)) {
+		boot_timing_buf.dropped += num_prev -
+			(BOOT_TIMING_MAX_ENTRIES - num_own);
+		num_prev = BOOT_TIMING_MAX_ENTRIES - num_own;
+	}
+
+	(void)memmove(&boot_timing_buf.entries[num_prev],
+		      &boot_timing_buf.entries[0],
+		      num_own * sizeof(boot_timing_entry_t));
+	(void)memcpy(&boot_timing_buf.entries[0], &prev->entries[0],
+		     num_prev * sizeof(boot_timing_entry_t));
+
+	boot_timing_buf.num_entries = num_own + num_prev;
+	boot_timing_buf.dropped += prev->dropped;
+}
+
+/*******************************************************************************
+ * Return the address of a BL_AUX_PARAM_BOOT_TIMING auxiliary parameter list,
+ * to be passed to the next stage. The records it points to are filled in when
+ * the BOOT_TIMING_EV_HANDOFF event is recorded.
+ ******************************************************************************/
+uintptr_t boot_timing_get_aux_param(void)
+{
+	struct bl_aux_param_uint64 *param = &boot_timing_handoff->param;
+
+	param->h.type = BL_AUX_PARAM_BOOT_TIMING;
+	param->h.next = 0U;
+	param->value = (uintptr_t)&boot_timing_handoff->buf;
+
+	flush_dcache_range((uintptr_t)param, sizeof(*param));
+
+	return (uintptr_t)param;
+}
+
+const boot_timing_buf_t *boot_timing_get_buf(void)
+{
+	return &boot_timing_buf;
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <lib/boot_timing.h>
+#include <plat/common/platform.h>
+#include <smccc_helpers.h>
+
+/*
+ * This function is responsible for handling all boot timing SMC calls from the
+ * Non-secure world.
+ */
+uintptr_t boot_timing_smc_handler(unsigned int smc_fid,
+				  u_register_t x1,
+				  u_register_t x2,
+				  u_register_t x3,
+				  u_register_t x4,
+				  void *cookie,
+				  void *handle,
+				  u_register_t flags)
+{
+	const boot_timing_buf_t *buf = boot_timing_get_buf();
+	const boot_timing_entry_t *entry;
+
+	switch (smc_fid) {
+	case BOOT_TIMING_SMC_GET_INFO:
+		/*
+		 * x0 --> error code.
+		 * x1 --> number of records.
+		 * x2 --> number of records dropped because the buffer was full.
+		 * x3 --> system counter frequency in Hz.
+		 */
+		SMC_RET4(handle, BOOT_TIMING_E_SUCCESS, buf->num_entries,
+			 buf->dropped, plat_get_syscnt_freq2());
+
+	case BOOT_TIMING_SMC_GET_ENTRY:
+		/*
+		 * x1 <-- record index.
+		 * x0 --> error code.
+		 * x1 --> system counter value.
+		 * x2 --> boot stage.
+		 * x3 --> event.
+		 * x4 --> image ID.
+		 */
+		if (x1 >= buf->num_entries) {
+			SMC_RET1(handle, BOOT_TIMING_E_INVALID_PARAMS);
+		}
+
+		entry = &buf->entries[x1];
+		SMC_RET5(handle, BOOT_TIMING_E_SUCCESS, entry->timestamp,
+			 entry->stage, entry->event, entry->image_id);
+
+	default:
+		break;
+	}
+
+	SMC_RET1(handle, SMC_UNK);
+}
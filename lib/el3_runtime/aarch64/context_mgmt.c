@@ -15,12 +15,15 @@
 #include <arch_helpers.h>
 #include <arch_features.h>
 #include <bl31/interrupt_mgmt.h>
+#include <bl31/sync_handle.h>
 #include <common/bl_common.h>
 #include <common/debug.h>
 #include <context.h>
 #include <drivers/arm/gicv3.h>
 #include <lib/el3_runtime/context_mgmt.h>
+#include <lib/el3_runtime/cpu_data.h>
 #include <lib/el3_runtime/pubsub_events.h>
+#include <lib/el3_trace.h>
 #include <lib/extensions/amu.h>
 #include <lib/extensions/brbe.h>
 #include <lib/extensions/mpam.h>
@@ -31,6 +34,7 @@
 #include <lib/extensions/trbe.h>
 #include <lib/extensions/trf.h>
 #include <lib/utils.h>
+#include <plat/common/platform.h>
 
 #if ENABLE_FEAT_TWED
 /* Make sure delay value fits within the range(0-15) */
@@ -275,6 +279,7 @@ static void setup_ns_context(cpu_context_t *ctx, const struct entry_point_info *
 			PMCR_EL0_N_MASK);
 	write_ctx_reg(get_el2_sysregs_ctx(ctx), CTX_MDCR_EL2, mdcr_el2);
 
+#if ENABLE_FEAT_HCX
 	if (is_feat_hcx_supported()) {
 		/*
 		 * Initialize register HCRX_EL2 with its init value.
@@ -287,6 +292,7 @@ static void setup_ns_context(cpu_context_t *ctx, const struct entry_point_info *
 		write_ctx_reg(get_el2_sysregs_ctx(ctx), CTX_HCRX_EL2,
 			HCRX_EL2_INIT_VAL);
 	}
+#endif /* ENABLE_FEAT_HCX */
 #endif /* CTX_INCLUDE_EL2_REGS */
 }
 
@@ -508,7 +514,7 @@ void cm_setup_context(cpu_context_t *ctx, const entry_point_info_t *ep)
  ******************************************************************************/
 static void manage_extensions_nonsecure(bool el2_unused, cpu_context_t *ctx)
 {
-#if IMAGE_BL31
+#ifdef IMAGE_BL31
 	if (is_feat_spe_supported()) {
 		spe_enable(el2_unused);
 	}
@@ -553,7 +559,7 @@ static void manage_extensions_nonsecure(bool el2_unused, cpu_context_t *ctx)
  ******************************************************************************/
 static void manage_extensions_secure(cpu_context_t *ctx)
 {
-#if IMAGE_BL31
+#ifdef IMAGE_BL31
 	if (is_feat_sve_supported()) {
 		if (ENABLE_SVE_FOR_SWD) {
 		/*
@@ -855,6 +861,28 @@ void cm_prepare_el3_exit(uint32_t security_state)
 
 #if CTX_INCLUDE_EL2_REGS
 
+/*
+ * Restore an EL2 register from the context. With CTX_EL2_LAZY_RESTORE, the
+ * register is only written when the value left by the world being switched
+ * out differs from the one to restore. It is only used for trap and
+ * configuration registers, which are usually identical in all worlds, so that
+ * the read usually saves a write. Registers holding per-world state, such as
+ * translation table bases or context IDs, are always written.
+ */
+#if CTX_EL2_LAZY_RESTORE
+#define el2_ctx_restore_reg(_reg, _ctx, _offset)			\
+	do {								\
+		u_register_t _val = read_ctx_reg((_ctx), (_offset));	\
+		if (read_##_reg() != _val) {				\
+			write_##_reg(_val);				\
+		}							\
+	} while (false)
+#else
+#define el2_ctx_restore_reg(_reg, _ctx, _offset)			\
+	write_##_reg(read_ctx_reg((_ctx), (_offset)))
+#endif /* CTX_EL2_LAZY_RESTORE */
+
+#if ENABLE_FEAT_FGT
 static void el2_sysregs_context_save_fgt(el2_sysregs_t *ctx)
 {
 	write_ctx_reg(ctx, CTX_HDFGRTR_EL2, read_hdfgrtr_el2());
@@ -869,16 +897,18 @@ static void el2_sysregs_context_save_fgt(el2_sysregs_t *ctx)
 
 static void el2_sysregs_context_restore_fgt(el2_sysregs_t *ctx)
 {
-	write_hdfgrtr_el2(read_ctx_reg(ctx, CTX_HDFGRTR_EL2));
+	el2_ctx_restore_reg(hdfgrtr_el2, ctx, CTX_HDFGRTR_EL2);
 	if (is_feat_amu_supported()) {
-		write_hafgrtr_el2(read_ctx_reg(ctx, CTX_HAFGRTR_EL2));
+		el2_ctx_restore_reg(hafgrtr_el2, ctx, CTX_HAFGRTR_EL2);
 	}
-	write_hdfgwtr_el2(read_ctx_reg(ctx, CTX_HDFGWTR_EL2));
-	write_hfgitr_el2(read_ctx_reg(ctx, CTX_HFGITR_EL2));
-	write_hfgrtr_el2(read_ctx_reg(ctx, CTX_HFGRTR_EL2));
-	write_hfgwtr_el2(read_ctx_reg(ctx, CTX_HFGWTR_EL2));
+	el2_ctx_restore_reg(hdfgwtr_el2, ctx, CTX_HDFGWTR_EL2);
+	el2_ctx_restore_reg(hfgitr_el2, ctx, CTX_HFGITR_EL2);
+	el2_ctx_restore_reg(hfgrtr_el2, ctx, CTX_HFGRTR_EL2);
+	el2_ctx_restore_reg(hfgwtr_el2, ctx, CTX_HFGWTR_EL2);
 }
+#endif /* ENABLE_FEAT_FGT */
 
+#if ENABLE_MPAM_FOR_LOWER_ELS
 static void el2_sysregs_context_save_mpam(el2_sysregs_t *ctx)
 {
 	u_register_t mpam_idr = read_mpamidr_el1();
@@ -940,34 +970,35 @@ static void el2_sysregs_context_restore_mpam(el2_sysregs_t *ctx)
 		return;
 	}
 
-	write_mpamhcr_el2(read_ctx_reg(ctx, CTX_MPAMHCR_EL2));
-	write_mpamvpm0_el2(read_ctx_reg(ctx, CTX_MPAMVPM0_EL2));
-	write_mpamvpmv_el2(read_ctx_reg(ctx, CTX_MPAMVPMV_EL2));
+	el2_ctx_restore_reg(mpamhcr_el2, ctx, CTX_MPAMHCR_EL2);
+	el2_ctx_restore_reg(mpamvpm0_el2, ctx, CTX_MPAMVPM0_EL2);
+	el2_ctx_restore_reg(mpamvpmv_el2, ctx, CTX_MPAMVPMV_EL2);
 
 	switch ((mpam_idr >> MPAMIDR_EL1_VPMR_MAX_SHIFT) & MPAMIDR_EL1_VPMR_MAX_MASK) {
 	case 7:
-		write_mpamvpm7_el2(read_ctx_reg(ctx, CTX_MPAMVPM7_EL2));
+		el2_ctx_restore_reg(mpamvpm7_el2, ctx, CTX_MPAMVPM7_EL2);
 		__fallthrough;
 	case 6:
-		write_mpamvpm6_el2(read_ctx_reg(ctx, CTX_MPAMVPM6_EL2));
+		el2_ctx_restore_reg(mpamvpm6_el2, ctx, CTX_MPAMVPM6_EL2);
 		__fallthrough;
 	case 5:
-		write_mpamvpm5_el2(read_ctx_reg(ctx, CTX_MPAMVPM5_EL2));
+		el2_ctx_restore_reg(mpamvpm5_el2, ctx, CTX_MPAMVPM5_EL2);
 		__fallthrough;
 	case 4:
-		write_mpamvpm4_el2(read_ctx_reg(ctx, CTX_MPAMVPM4_EL2));
+		el2_ctx_restore_reg(mpamvpm4_el2, ctx, CTX_MPAMVPM4_EL2);
 		__fallthrough;
 	case 3:
-		write_mpamvpm3_el2(read_ctx_reg(ctx, CTX_MPAMVPM3_EL2));
+		el2_ctx_restore_reg(mpamvpm3_el2, ctx, CTX_MPAMVPM3_EL2);
 		__fallthrough;
 	case 2:
-		write_mpamvpm2_el2(read_ctx_reg(ctx, CTX_MPAMVPM2_EL2));
+		el2_ctx_restore_reg(mpamvpm2_el2, ctx, CTX_MPAMVPM2_EL2);
 		__fallthrough;
 	case 1:
-		write_mpamvpm1_el2(read_ctx_reg(ctx, CTX_MPAMVPM1_EL2));
+		el2_ctx_restore_reg(mpamvpm1_el2, ctx, CTX_MPAMVPM1_EL2);
 		break;
 	}
 }
+#endif /* ENABLE_MPAM_FOR_LOWER_ELS */
 
 /*******************************************************************************
  * Save EL2 sysreg context
@@ -994,67 +1025,95 @@ void cm_el2_sysregs_context_save(uint32_t security_state)
 #if CTX_INCLUDE_MTE_REGS
 		el2_sysregs_context_save_mte(el2_sysregs_ctx);
 #endif
+#if ENABLE_MPAM_FOR_LOWER_ELS
 		if (is_feat_mpam_supported()) {
 			el2_sysregs_context_save_mpam(el2_sysregs_ctx);
 		}
+#endif
 
+#if ENABLE_FEAT_FGT
 		if (is_feat_fgt_supported()) {
 			el2_sysregs_context_save_fgt(el2_sysregs_ctx);
 		}
+#endif
 
+#if ENABLE_FEAT_ECV
 		if (is_feat_ecv_v2_supported()) {
 			write_ctx_reg(el2_sysregs_ctx, CTX_CNTPOFF_EL2,
 				      read_cntpoff_el2());
 		}
+#endif
 
+#if ENABLE_FEAT_VHE
 		if (is_feat_vhe_supported()) {
 			write_ctx_reg(el2_sysregs_ctx, CTX_CONTEXTIDR_EL2,
 				      read_contextidr_el2());
 			write_ctx_reg(el2_sysregs_ctx, CTX_TTBR1_EL2,
 				      read_ttbr1_el2());
 		}
+#endif
 
+#if ENABLE_FEAT_RAS
 		if (is_feat_ras_supported()) {
 			write_ctx_reg(el2_sysregs_ctx, CTX_VDISR_EL2,
 				      read_vdisr_el2());
 			write_ctx_reg(el2_sysregs_ctx, CTX_VSESR_EL2,
 				      read_vsesr_el2());
 		}
+#endif
 
+#if CTX_INCLUDE_NEVE_REGS
 		if (is_feat_nv2_supported()) {
 			write_ctx_reg(el2_sysregs_ctx, CTX_VNCR_EL2,
 				      read_vncr_el2());
 		}
+#endif
 
+#if ENABLE_TRF_FOR_NS
 		if (is_feat_trf_supported()) {
 			write_ctx_reg(el2_sysregs_ctx, CTX_TRFCR_EL2, read_trfcr_el2());
 		}
+#endif
 
+#if ENABLE_FEAT_CSV2_2
 		if (is_feat_csv2_2_supported()) {
 			write_ctx_reg(el2_sysregs_ctx, CTX_SCXTNUM_EL2,
 				      read_scxtnum_el2());
 		}
+#endif
 
+#if ENABLE_FEAT_HCX
 		if (is_feat_hcx_supported()) {
 			write_ctx_reg(el2_sysregs_ctx, CTX_HCRX_EL2, read_hcrx_el2());
 		}
+#endif
+#if ENABLE_FEAT_TCR2
 		if (is_feat_tcr2_supported()) {
 			write_ctx_reg(el2_sysregs_ctx, CTX_TCR2_EL2, read_tcr2_el2());
 		}
+#endif
+#if ENABLE_FEAT_S1PIE || ENABLE_FEAT_S2PIE
 		if (is_feat_sxpie_supported()) {
 			write_ctx_reg(el2_sysregs_ctx, CTX_PIRE0_EL2, read_pire0_el2());
 			write_ctx_reg(el2_sysregs_ctx, CTX_PIR_EL2, read_pir_el2());
 		}
+#endif
+#if ENABLE_FEAT_S2PIE
 		if (is_feat_s2pie_supported()) {
 			write_ctx_reg(el2_sysregs_ctx, CTX_S2PIR_EL2, read_s2pir_el2());
 		}
+#endif
+#if ENABLE_FEAT_S1POE || ENABLE_FEAT_S2POE
 		if (is_feat_sxpoe_supported()) {
 			write_ctx_reg(el2_sysregs_ctx, CTX_POR_EL2, read_por_el2());
 		}
+#endif
+#if ENABLE_FEAT_GCS
 		if (is_feat_gcs_supported()) {
 			write_ctx_reg(el2_sysregs_ctx, CTX_GCSPR_EL2, read_gcspr_el2());
 			write_ctx_reg(el2_sysregs_ctx, CTX_GCSCR_EL2, read_gcscr_el2());
 		}
+#endif
 	}
 }
 
@@ -1083,61 +1142,88 @@ void cm_el2_sysregs_context_restore(uint32_t security_state)
 #if CTX_INCLUDE_MTE_REGS
 		el2_sysregs_context_restore_mte(el2_sysregs_ctx);
 #endif
+#if ENABLE_MPAM_FOR_LOWER_ELS
 		if (is_feat_mpam_supported()) {
 			el2_sysregs_context_restore_mpam(el2_sysregs_ctx);
 		}
+#endif
 
+#if ENABLE_FEAT_FGT
 		if (is_feat_fgt_supported()) {
 			el2_sysregs_context_restore_fgt(el2_sysregs_ctx);
 		}
+#endif
 
+#if ENABLE_FEAT_ECV
 		if (is_feat_ecv_v2_supported()) {
-			write_cntpoff_el2(read_ctx_reg(el2_sysregs_ctx,
-						       CTX_CNTPOFF_EL2));
+			el2_ctx_restore_reg(cntpoff_el2, el2_sysregs_ctx, CTX_CNTPOFF_EL2);
 		}
+#endif
 
+#if ENABLE_FEAT_VHE
 		if (is_feat_vhe_supported()) {
 			write_contextidr_el2(read_ctx_reg(el2_sysregs_ctx, CTX_CONTEXTIDR_EL2));
 			write_ttbr1_el2(read_ctx_reg(el2_sysregs_ctx, CTX_TTBR1_EL2));
 		}
+#endif
 
+#if ENABLE_FEAT_RAS
 		if (is_feat_ras_supported()) {
 			write_vdisr_el2(read_ctx_reg(el2_sysregs_ctx, CTX_VDISR_EL2));
 			write_vsesr_el2(read_ctx_reg(el2_sysregs_ctx, CTX_VSESR_EL2));
 		}
+#endif
 
+#if CTX_INCLUDE_NEVE_REGS
 		if (is_feat_nv2_supported()) {
 			write_vncr_el2(read_ctx_reg(el2_sysregs_ctx, CTX_VNCR_EL2));
 		}
+#endif
+#if ENABLE_TRF_FOR_NS
 		if (is_feat_trf_supported()) {
-			write_trfcr_el2(read_ctx_reg(el2_sysregs_ctx, CTX_TRFCR_EL2));
+			el2_ctx_restore_reg(trfcr_el2, el2_sysregs_ctx, CTX_TRFCR_EL2);
 		}
+#endif
 
+#if ENABLE_FEAT_CSV2_2
 		if (is_feat_csv2_2_supported()) {
 			write_scxtnum_el2(read_ctx_reg(el2_sysregs_ctx,
 						       CTX_SCXTNUM_EL2));
 		}
+#endif
 
+#if ENABLE_FEAT_HCX
 		if (is_feat_hcx_supported()) {
-			write_hcrx_el2(read_ctx_reg(el2_sysregs_ctx, CTX_HCRX_EL2));
+			el2_ctx_restore_reg(hcrx_el2, el2_sysregs_ctx, CTX_HCRX_EL2);
 		}
+#endif
+#if ENABLE_FEAT_TCR2
 		if (is_feat_tcr2_supported()) {
-			write_tcr2_el2(read_ctx_reg(el2_sysregs_ctx, CTX_TCR2_EL2));
+			el2_ctx_restore_reg(tcr2_el2, el2_sysregs_ctx, CTX_TCR2_EL2);
 		}
+#endif
+#if ENABLE_FEAT_S1PIE || ENABLE_FEAT_S2PIE
 		if (is_feat_sxpie_supported()) {
-			write_pire0_el2(read_ctx_reg(el2_sysregs_ctx, CTX_PIRE0_EL2));
-			write_pir_el2(read_ctx_reg(el2_sysregs_ctx, CTX_PIR_EL2));
+			el2_ctx_restore_reg(pire0_el2, el2_sysregs_ctx, CTX_PIRE0_EL2);
+			el2_ctx_restore_reg(pir_el2, el2_sysregs_ctx, CTX_PIR_EL2);
 		}
+#endif
+#if ENABLE_FEAT_S2PIE
 		if (is_feat_s2pie_supported()) {
-			write_s2pir_el2(read_ctx_reg(el2_sysregs_ctx, CTX_S2PIR_EL2));
+			el2_ctx_restore_reg(s2pir_el2, el2_sysregs_ctx, CTX_S2PIR_EL2);
 		}
+#endif
+#if ENABLE_FEAT_S1POE || ENABLE_FEAT_S2POE
 		if (is_feat_sxpoe_supported()) {
 			write_por_el2(read_ctx_reg(el2_sysregs_ctx, CTX_POR_EL2));
 		}
+#endif
+#if ENABLE_FEAT_GCS
 		if (is_feat_gcs_supported()) {
-			write_gcscr_el2(read_ctx_reg(el2_sysregs_ctx, CTX_GCSCR_EL2));
+			el2_ctx_restore_reg(gcscr_el2, el2_sysregs_ctx, CTX_GCSCR_EL2);
 			write_gcspr_el2(read_ctx_reg(el2_sysregs_ctx, CTX_GCSPR_EL2));
 		}
+#endif
 	}
 }
 #endif /* CTX_INCLUDE_EL2_REGS */
@@ -1204,7 +1290,7 @@ void cm_el1_sysregs_context_save(uint32_t security_state)
 
 	el1_sysregs_context_save(get_el1_sysregs_ctx(ctx));
 
-#if IMAGE_BL31
+#ifdef IMAGE_BL31
 	if (security_state == SECURE)
 		PUBLISH_EVENT(cm_exited_secure_world);
 	else
@@ -1221,7 +1307,7 @@ void cm_el1_sysregs_context_restore(uint32_t security_state)
 
 	el1_sysregs_context_restore(get_el1_sysregs_ctx(ctx));
 
-#if IMAGE_BL31
+#ifdef IMAGE_BL31
 	if (security_state == SECURE)
 		PUBLISH_EVENT(cm_entering_secure_world);
 	else
@@ -1229,6 +1315,195 @@ void cm_el1_sysregs_context_restore(uint32_t security_state)
 #endif
 }
 
+#if CTX_INCLUDE_FPREGS
+#if CTX_LAZY_FPREGS
+/*******************************************************************************
+ * Per-CPU state of the lazy FP/SIMD switching. 'owner' is the security state
+ * whose registers are live in the register file plus one, zero meaning that
+ * the live registers belong to no security state. 'trapped' has one bit per
+ * security state whose CPTR_EL3.TFP was set by this code, as opposed to being
+ * set because FP/SIMD is disabled for that world (see sve_disable()).
+ ******************************************************************************/
+typedef struct fpregs_lazy_state {
+	unsigned int owner;
+	unsigned int trapped;
+} fpregs_lazy_state_t;
+
+static fpregs_lazy_state_t fpregs_lazy_state[PLATFORM_CORE_COUNT];
+
+/*
+ * Tell whether the given security state is trapped by this code. The cached
+ * bit is only trusted while CPTR_EL3.TFP is still set in the context: if the
+ * context has been rebuilt since, e.g. by cm_init_my_context(), the trap is
+ * gone and the stale bit is dropped.
+ */
+static bool fpregs_lazy_is_trapped(fpregs_lazy_state_t *state,
+				   uint32_t security_state)
+{
+	el3_state_t *el3_ctx;
+
+	if ((state->trapped & BIT_32(security_state)) == 0U) {
+		return false;
+	}
+
+	el3_ctx = get_el3state_ctx(cm_get_context(security_state));
+	if ((read_ctx_reg(el3_ctx, CTX_CPTR_EL3) & TFP_BIT) == 0U) {
+		state->trapped &= ~BIT_32(security_state);
+		return false;
+	}
+
+	return true;
+}
+
+static void fpregs_lazy_set_trap(fpregs_lazy_state_t *state,
+				 uint32_t security_state, bool trap)
+{
+	el3_state_t *el3_ctx;
+	u_register_t cptr_el3;
+
+	el3_ctx = get_el3state_ctx(cm_get_context(security_state));
+	cptr_el3 = read_ctx_reg(el3_ctx, CTX_CPTR_EL3);
+
+	if (!fpregs_lazy_is_trapped(state, security_state)) {
+		/* Never touch a trap that this code did not set */
+		if ((cptr_el3 & TFP_BIT) != 0U) {
+			return;
+		}
+
+		if (trap) {
+			write_ctx_reg(el3_ctx, CTX_CPTR_EL3, cptr_el3 | TFP_BIT);
+			state->trapped |= BIT_32(security_state);
+		}
+	} else if (!trap) {
+		write_ctx_reg(el3_ctx, CTX_CPTR_EL3, cptr_el3 & ~TFP_BIT);
+		state->trapped &= ~BIT_32(security_state);
+	}
+}
+
+/*
+ * Make the FP/SIMD registers accessible from EL3 for as long as the current
+ * exception is being handled. CPTR_EL3 is reprogrammed from the context of
+ * the next world by el3_exit().
+ */
+static void fpregs_lazy_el3_access(void)
+{
+	write_cptr_el3(read_cptr_el3() & ~TFP_BIT);
+	isb();
+}
+
+/*******************************************************************************
+ * Called on a trapped FP/SIMD access from a lower EL. Saves the live registers
+ * to the context of their owner, loads the registers of the trapping world and
+ * lets it retry the instruction without the trap.
+ ******************************************************************************/
+int cm_fpregs_lazy_trap(cpu_context_t *ctx)
+{
+	fpregs_lazy_state_t *state = &fpregs_lazy_state[plat_my_core_pos()];
+	uint32_t security_state;
+
+	for (security_state = 0U; security_state < CPU_CONTEXT_NUM;
+	     security_state++) {
+		if (cm_get_context(security_state) == ctx) {
+			break;
+		}
+	}
+
+	if ((security_state == CPU_CONTEXT_NUM) ||
+	    !fpregs_lazy_is_trapped(state, security_state)) {
+		/* FP/SIMD is disabled for this world, not lazily trapped */
+		return TRAP_RET_UNHANDLED;
+	}
+
+	fpregs_lazy_el3_access();
+
+	if (state->owner != 0U) {
+		fpregs_context_save(get_fpregs_ctx(
+				cm_get_context(state->owner - 1U)));
+		fpregs_lazy_set_trap(state, state->owner - 1U, true);
+	}
+
+	fpregs_context_restore(get_fpregs_ctx(ctx));
+	fpregs_lazy_set_trap(state, security_state, false);
+	state->owner = security_state + 1U;
+
+	return TRAP_RET_REPEAT;
+}
+
+/*******************************************************************************
+ * Forget the lazy FP/SIMD state of the calling CPU. Called on the CPU_ON
+ * finish path before the Secure Payload Dispatcher reinitialises its context,
+ * as none of the previous ownership or traps survive the power cycle.
+ ******************************************************************************/
+void cm_fpregs_lazy_reset(void)
+{
+	fpregs_lazy_state_t *state = &fpregs_lazy_state[plat_my_core_pos()];
+
+	state->owner = 0U;
+	state->trapped = 0U;
+}
+
+#ifdef IMAGE_BL31
+/*
+ * The register file does not survive a power down, so write it back to its
+ * owner beforehand and have the owner trap on its next FP/SIMD access.
+ */
+static void *fpregs_lazy_flush(const void *arg)
+{
+	fpregs_lazy_state_t *state = &fpregs_lazy_state[plat_my_core_pos()];
+
+	if (state->owner != 0U) {
+		fpregs_lazy_el3_access();
+		fpregs_context_save(get_fpregs_ctx(
+				cm_get_context(state->owner - 1U)));
+		fpregs_lazy_set_trap(state, state->owner - 1U, true);
+		state->owner = 0U;
+	}
+
+	return (void *)arg;
+}
+SUBSCRIBE_TO_EVENT(psci_cpu_off_start, fpregs_lazy_flush);
+SUBSCRIBE_TO_EVENT(psci_suspend_pwrdown_start, fpregs_lazy_flush);
+#endif /* IMAGE_BL31 */
+#endif /* CTX_LAZY_FPREGS */
+
+/*******************************************************************************
+ * The next two functions are used by runtime services to save and restore the
+ * FP/SIMD registers of the specified security state around a world switch.
+ * With CTX_LAZY_FPREGS=1 no registers are moved here: the incoming world is
+ * made to trap on its first FP/SIMD access unless it already owns the live
+ * registers, and the switch is done by cm_fpregs_lazy_trap().
+ ******************************************************************************/
+void cm_fpregs_context_save(uint32_t security_state)
+{
+#if CTX_LAZY_FPREGS
+	fpregs_lazy_state_t *state = &fpregs_lazy_state[plat_my_core_pos()];
+
+	/*
+	 * A world that was not trapped may have used the registers without
+	 * claiming them. Record it as the owner.
+	 */
+	if ((state->owner == 0U) &&
+	    !fpregs_lazy_is_trapped(state, security_state)) {
+		state->owner = security_state + 1U;
+	}
+#else
+	fpregs_context_save(get_fpregs_ctx(cm_get_context(security_state)));
+#endif
+}
+
+void cm_fpregs_context_restore(uint32_t security_state)
+{
+#if CTX_LAZY_FPREGS
+	fpregs_lazy_state_t *state = &fpregs_lazy_state[plat_my_core_pos()];
+
+	fpregs_lazy_set_trap(state, security_state,
+			     state->owner != (security_state + 1U));
+#else
+	fpregs_context_restore(get_fpregs_ctx(cm_get_context(security_state)));
+#endif
+}
+#endif /* CTX_INCLUDE_FPREGS */
+
 /*******************************************************************************
  * This function populates ELR_EL3 member of 'cpu_context' pertaining to the
  * given security state with the given entrypoint
@@ -1327,5 +1602,7 @@ void cm_set_next_eret_context(uint32_t security_state)
 	ctx = cm_get_context(security_state);
 	assert(ctx != NULL);
 
+	EL3_TRACE(EL3_TRACE_EV_WORLD_SWITCH, security_state, 0U, 0U);
+
 	cm_set_next_context(ctx);
 }
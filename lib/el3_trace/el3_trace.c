@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <lib/el3_trace.h>
+#include <lib/spinlock.h>
+#include <lib/utils.h>
+#include <lib/xlat_tables/xlat_tables_v2.h>
+#include <plat/common/platform.h>
+
+/* Size reserved for the header of each per-CPU ring */
+#define EL3_TRACE_RING_HDR_SIZE		U(64)
+
+/* Smallest usable number of entries per CPU */
+#define EL3_TRACE_MIN_ENTRIES		U(16)
+
+CASSERT(sizeof(el3_trace_hdr_t) <= EL3_TRACE_HDR_SIZE,
+	assert_el3_trace_hdr_size_mismatch);
+CASSERT(sizeof(el3_trace_ring_hdr_t) <= EL3_TRACE_RING_HDR_SIZE,
+	assert_el3_trace_ring_hdr_size_mismatch);
+CASSERT(sizeof(el3_trace_entry_t) == 32U,
+	assert_el3_trace_entry_size_mismatch);
+
+/* Mask of the enabled events, read by every tracepoint */
+uint64_t el3_trace_events;
+
+/* Virtual address of the shared buffer, zero until it has been set up */
+static uintptr_t el3_trace_base;
+static size_t el3_trace_size;
+static uint64_t el3_trace_stride;
+static uint32_t el3_trace_entries;
+
+static spinlock_t el3_trace_lock;
+
+/*******************************************************************************
+ * Append an entry to the ring of the calling CPU. Each CPU is the only writer
+ * of its own ring, so no lock is needed: the entry is written first, then the
+ * head is advanced with release semantics. When the ring is full the oldest
+ * entry is overwritten.
+ *
+ * The head lives in Non-secure memory and may be modified by the Non-secure
+ * world, so it is only ever used masked to the size of the ring.
+ ******************************************************************************/
+void el3_trace_record(unsigned int event, uint32_t arg0, uint64_t arg1,
+		      uint64_t arg2)
+{
+	unsigned int cpu = plat_my_core_pos();
+	uintptr_t ring;
+	el3_trace_ring_hdr_t *ring_hdr;
+	el3_trace_entry_t *entry;
+	uint64_t head;
+
+	assert(el3_trace_base != 0U);
+	assert(cpu < PLATFORM_CORE_COUNT);
+
+	ring = el3_trace_base + EL3_TRACE_HDR_SIZE +
+		((uint64_t)cpu * el3_trace_stride);
+	ring_hdr = (el3_trace_ring_hdr_t *)ring;
+	head = ring_hdr->head;
+
+	entry = (el3_trace_entry_t *)(ring + EL3_TRACE_RING_HDR_SIZE);
+	entry += head & (el3_trace_entries - 1U);
+
+	entry->timestamp = read_cntpct_el0();
+	entry->event = (uint16_t)event;
+	entry->cpu = (uint16_t)cpu;
+	entry->arg0 = arg0;
+	entry->arg1 = arg1;
+	entry->arg2 = arg2;
+
+	/* Make the entry visible before publishing the new head */
+	dmbishst();
+	ring_hdr->head = head + 1U;
+}
+
+/*******************************************************************************
+ * Map the Non-secure buffer at 'base_pa' and lay the per-CPU rings out in it.
+ * The buffer is mapped with the Non-secure attribute so that EL3 cannot be
+ * tricked into writing trace data to Secure memory. It can only be set up
+ * once.
+ ******************************************************************************/
+int el3_trace_setup(uint64_t base_pa, size_t size)
+{
+	el3_trace_hdr_t *hdr;
+	uintptr_t base_va;
+	uint64_t per_cpu, entries;
+	int rc;
+
+	if ((base_pa == 0U) || (size == 0U) ||
+	    !IS_PAGE_ALIGNED(base_pa) || !IS_PAGE_ALIGNED(size)) {
+		return EL3_TRACE_E_INVALID_PARAMS;
+	}
+
+	/* Largest power of two number of entries that fits for each CPU */
+	per_cpu = (size - EL3_TRACE_HDR_SIZE) / PLATFORM_CORE_COUNT;
+	if (per_cpu < (EL3_TRACE_RING_HDR_SIZE +
+		       (EL3_TRACE_MIN_ENTRIES * sizeof(el3_trace_entry_t)))) {
+		return EL3_TRACE_E_NO_MEMORY;
+	}
+
+	entries = (per_cpu - EL3_TRACE_RING_HDR_SIZE) /
+		sizeof(el3_trace_entry_t);
+	entries = ULL(1) << (63U - __builtin_clzll(entries));
+
+	spin_lock(&el3_trace_lock);
+
+	if (el3_trace_base != 0U) {
+		spin_unlock(&el3_trace_lock);
+		return EL3_TRACE_E_DENIED;
+	}
+
+	spin_lock(&mmap_dynamic_region_lock);
+	rc = mmap_add_dynamic_region_alloc_va(base_pa, &base_va, size,
+			MT_MEMORY | MT_RW | MT_NS | MT_EXECUTE_NEVER);
+	spin_unlock(&mmap_dynamic_region_lock);
+	if (rc != 0) {
+		spin_unlock(&el3_trace_lock);
+		WARN("EL3 trace: failed to map buffer (%d)\n", rc);
+		return EL3_TRACE_E_NO_MEMORY;
+	}
+
+	zeromem((void *)base_va, size);
+
+	el3_trace_entries = (uint32_t)entries;
+	el3_trace_stride = EL3_TRACE_RING_HDR_SIZE +
+		(entries * sizeof(el3_trace_entry_t));
+
+	hdr = (el3_trace_hdr_t *)base_va;
+	hdr->magic = EL3_TRACE_MAGIC;
+	hdr->version = EL3_TRACE_VERSION;
+	hdr->num_cpus = PLATFORM_CORE_COUNT;
+	hdr->entries_per_cpu = el3_trace_entries;
+	hdr->entry_size = sizeof(el3_trace_entry_t);
+	hdr->counter_freq = read_cntfrq_el0();
+	hdr->ring_offset = EL3_TRACE_HDR_SIZE;
+	hdr->ring_stride = el3_trace_stride;
+
+	el3_trace_size = size;
+
+	/* Publish the buffer before any tracepoint can be enabled */
+	dsbish();
+	el3_trace_base = base_va;
+
+	spin_unlock(&el3_trace_lock);
+
+	INFO("EL3 trace: %u entries per CPU at 0x%llx\n", el3_trace_entries,
+	     (unsigned long long)base_pa);
+
+	return EL3_TRACE_E_SUCCESS;
+}
+
+/*******************************************************************************
+ * Set the mask of enabled events. A zero mask stops tracing.
+ ******************************************************************************/
+int el3_trace_control(uint64_t events)
+{
+	if (el3_trace_base == 0U) {
+		return EL3_TRACE_E_DENIED;
+	}
+
+	el3_trace_events = events;
+	dsbish();
+
+	return EL3_TRACE_E_SUCCESS;
+}
+
+/*******************************************************************************
+ * Return the size of the shared buffer and of each per-CPU ring.
+ ******************************************************************************/
+void el3_trace_get_info(size_t *size, uint32_t *entries_per_cpu)
+{
+	*size = el3_trace_size;
+	*entries_per_cpu = el3_trace_entries;
+}
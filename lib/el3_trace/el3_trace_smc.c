@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <lib/el3_trace.h>
+#include <smccc_helpers.h>
+
+/*
+ * This function is responsible for handling all EL3 trace SMC calls from the
+ * Non-secure world.
+ */
+uintptr_t el3_trace_smc_handler(unsigned int smc_fid,
+				u_register_t x1,
+				u_register_t x2,
+				u_register_t x3,
+				u_register_t x4,
+				void *cookie,
+				void *handle,
+				u_register_t flags)
+{
+	size_t size;
+	uint32_t entries;
+
+	switch (smc_fid) {
+	case EL3_TRACE_SMC_SETUP:
+		/*
+		 * x1 <-- physical address of the Non-secure buffer.
+		 * x2 <-- size of the buffer in bytes.
+		 * x0 --> error code.
+		 */
+		SMC_RET1(handle, el3_trace_setup(x1, x2));
+
+	case EL3_TRACE_SMC_CONTROL:
+		/*
+		 * x1 <-- mask of events to enable, zero to stop tracing.
+		 * x0 --> error code.
+		 */
+		SMC_RET1(handle, el3_trace_control(x1));
+
+	case EL3_TRACE_SMC_GET_INFO:
+		/*
+		 * x0 --> error code.
+		 * x1 --> size of the shared buffer, zero if not set up.
+		 * x2 --> number of entries in each per-CPU ring.
+		 * x3 --> size of an entry in bytes.
+		 */
+		el3_trace_get_info(&size, &entries);
+		SMC_RET4(handle, EL3_TRACE_E_SUCCESS, size, entries,
+			 sizeof(el3_trace_entry_t));
+
+	default:
+		break;
+	}
+
+	SMC_RET1(handle, SMC_UNK);
+}
@@ -29,14 +29,27 @@
 #	include <lib/mpmm/mpmm.h>
 #endif
 
+/*
+ * Counters whose values, and virtual offsets, are preserved across power down
+ * if they are enabled at boot. Platforms can leave out counters that no one
+ * reads to shorten the entry into and exit from power down states.
+ */
+#ifndef PLAT_AMU_GROUP0_SAVE_MASK
+#define PLAT_AMU_GROUP0_SAVE_MASK	U(0xffff)
+#endif
+
+#ifndef PLAT_AMU_GROUP1_SAVE_MASK
+#define PLAT_AMU_GROUP1_SAVE_MASK	U(0xffff)
+#endif
+
 struct amu_ctx {
 	uint64_t group0_cnts[AMU_GROUP0_MAX_COUNTERS];
 #if ENABLE_AMU_AUXILIARY_COUNTERS
 	uint64_t group1_cnts[AMU_GROUP1_MAX_COUNTERS];
 #endif
 
-	/* Architected event counter 1 does not have an offset register */
-	uint64_t group0_voffsets[AMU_GROUP0_MAX_COUNTERS - 1U];
+	/* Indexed by counter, entries of counters without an offset are unused */
+	uint64_t group0_voffsets[AMU_GROUP0_MAX_COUNTERS];
 #if ENABLE_AMU_AUXILIARY_COUNTERS
 	uint64_t group1_voffsets[AMU_GROUP1_MAX_COUNTERS];
 #endif
@@ -45,6 +58,17 @@ struct amu_ctx {
 #if ENABLE_AMU_AUXILIARY_COUNTERS
 	uint16_t group1_enable;
 #endif
+
+	/*
+	 * Counters, and counters with a virtual offset, saved on power down.
+	 * Computed once by amu_enable().
+	 */
+	uint16_t group0_save;
+	uint16_t group0_save_voff;
+#if ENABLE_AMU_AUXILIARY_COUNTERS
+	uint16_t group1_save;
+	uint16_t group1_save_voff;
+#endif
 };
 
 static struct amu_ctx amu_ctxs_[PLATFORM_CORE_COUNT];
@@ -184,6 +208,8 @@ static __unused bool amu_group1_supported(void)
 }
 #endif
 
+static void amu_save_set_init(void);
+
 /*
  * Enable counters. This function is meant to be invoked by the context
  * management library before exiting from EL3.
@@ -292,6 +318,8 @@ void amu_enable(bool el2_unused, cpu_context_t *ctx)
 #endif
 	}
 
+	amu_save_set_init();
+
 #if ENABLE_MPMM
 	mpmm_enable();
 #endif
@@ -306,14 +334,16 @@ static uint64_t amu_group0_cnt_read(unsigned int idx)
 	return amu_group0_cnt_read_internal(idx);
 }
 
-/* Write the group 0 counter identified by the given `idx` with `val` */
+/*
+ * Write the group 0 counter identified by the given `idx` with `val`. The
+ * caller must issue an ISB before relying on the new value.
+ */
 static void amu_group0_cnt_write(unsigned  int idx, uint64_t val)
 {
 	assert(is_feat_amu_supported());
 	assert(idx < read_amcgcr_el0_cg0nc());
 
 	amu_group0_cnt_write_internal(idx, val);
-	isb();
 }
 
 /*
@@ -358,7 +388,8 @@ static uint64_t amu_group0_voffset_read(unsigned int idx)
 
 /*
  * Write the group 0 offset register for a given index. Index must be 0, 2, or
- * 3, the register for 1 does not exist.
+ * 3, the register for 1 does not exist. The caller must issue an ISB before
+ * relying on the new value.
  *
  * Using this function requires FEAT_AMUv1p1 support.
  */
@@ -369,7 +400,6 @@ static void amu_group0_voffset_write(unsigned int idx, uint64_t val)
 	assert(idx != 1U);
 
 	amu_group0_voffset_write_internal(idx, val);
-	isb();
 }
 
 #if ENABLE_AMU_AUXILIARY_COUNTERS
@@ -383,7 +413,10 @@ static uint64_t amu_group1_cnt_read(unsigned int idx)
 	return amu_group1_cnt_read_internal(idx);
 }
 
-/* Write the group 1 counter identified by the given `idx` with `val` */
+/*
+ * Write the group 1 counter identified by the given `idx` with `val`. The
+ * caller must issue an ISB before relying on the new value.
+ */
 static void amu_group1_cnt_write(unsigned int idx, uint64_t val)
 {
 	assert(is_feat_amu_supported());
@@ -391,7 +424,6 @@ static void amu_group1_cnt_write(unsigned int idx, uint64_t val)
 	assert(idx < read_amcgcr_el0_cg1nc());
 
 	amu_group1_cnt_write_internal(idx, val);
-	isb();
 }
 
 /*
@@ -410,7 +442,8 @@ static uint64_t amu_group1_voffset_read(unsigned int idx)
 }
 
 /*
- * Write the group 1 offset register for a given index.
+ * Write the group 1 offset register for a given index. The caller must issue
+ * an ISB before relying on the new value.
  *
  * Using this function requires FEAT_AMUv1p1 support.
  */
@@ -422,24 +455,70 @@ static void amu_group1_voffset_write(unsigned int idx, uint64_t val)
 	assert((read_amcg1idr_el0_voff() & (UINT64_C(1) << idx)) != 0U);
 
 	amu_group1_voffset_write_internal(idx, val);
-	isb();
 }
 #endif
 
-static void *amu_context_save(const void *arg)
+/*
+ * Record the counters of this CPU that are saved on power down: those enabled
+ * at boot and selected by the platform, along with those of them that have a
+ * virtual offset. This avoids reading the AMU configuration registers, and
+ * accessing unused counters, on every power down.
+ */
+static void amu_save_set_init(void)
 {
-	uint64_t i, j;
+	struct amu_ctx *ctx = &amu_ctxs_[plat_my_core_pos()];
+	uint64_t amcgcr_el0_cg0nc = read_amcgcr_el0_cg0nc();
+	uint64_t i;
 
+	ctx->group0_save = (uint16_t)(read_amcntenset0_el0_px() &
+				      PLAT_AMU_GROUP0_SAVE_MASK);
+	ctx->group0_save_voff = 0U;
+
+	if (is_feat_amuv1p1_supported()) {
+		for (i = 0U; i < amcgcr_el0_cg0nc; i++) {
+			if ((((ctx->group0_save >> i) & 1U) != 0U) &&
+			    amu_group0_voffset_supported(i)) {
+				ctx->group0_save_voff |= (uint16_t)(1U << i);
+			}
+		}
+	}
+
+#if ENABLE_AMU_AUXILIARY_COUNTERS
+	ctx->group1_save = 0U;
+	ctx->group1_save_voff = 0U;
+
+	if (amu_group1_supported()) {
+		ctx->group1_save = (uint16_t)(read_amcntenset1_el0_px() &
+					      PLAT_AMU_GROUP1_SAVE_MASK);
+
+		if (is_feat_amuv1p1_supported()) {
+			ctx->group1_save_voff = ctx->group1_save &
+				(uint16_t)read_amcg1idr_el0_voff();
+		}
+	}
+#endif
+}
+
+/* Return the index of the lowest counter in 'mask', and remove it from it */
+static inline unsigned int amu_next_counter(unsigned int *mask)
+{
+	unsigned int idx = (unsigned int)__builtin_ctz(*mask);
+
+	*mask &= *mask - 1U;
+
+	return idx;
+}
+
+static void *amu_context_save(const void *arg)
+{
 	unsigned int core_pos;
 	struct amu_ctx *ctx;
+	unsigned int mask, i;
 
 	uint64_t hcr_el2_amvoffen = 0;	/* AMU virtual offsets enabled */
-	uint64_t amcgcr_el0_cg0nc;	/* Number of group 0 counters */
 
 #if ENABLE_AMU_AUXILIARY_COUNTERS
-	uint64_t amcg1idr_el0_voff;	/* Auxiliary counters with virtual offsets */
 	uint64_t amcfgr_el0_ncg;	/* Number of counter groups */
-	uint64_t amcgcr_el0_cg1nc;	/* Number of group 1 counters */
 #endif
 
 	if (!is_feat_amu_supported()) {
@@ -449,15 +528,12 @@ static void *amu_context_save(const void *arg)
 	core_pos = plat_my_core_pos();
 	ctx = &amu_ctxs_[core_pos];
 
-	amcgcr_el0_cg0nc = read_amcgcr_el0_cg0nc();
 	if (is_feat_amuv1p1_supported()) {
 		hcr_el2_amvoffen = read_hcr_el2_amvoffen();
 	}
 
 #if ENABLE_AMU_AUXILIARY_COUNTERS
 	amcfgr_el0_ncg = read_amcfgr_el0_ncg();
-	amcgcr_el0_cg1nc = (amcfgr_el0_ncg > 0U) ? read_amcgcr_el0_cg1nc() : 0U;
-	amcg1idr_el0_voff = (hcr_el2_amvoffen != 0U) ? read_amcg1idr_el0_voff() : 0U;
 #endif
 
 	/*
@@ -475,17 +551,21 @@ static void *amu_context_save(const void *arg)
 #endif
 
 	/*
-	 * Save the counters to the local context.
+	 * Save the counters selected at boot to the local context.
 	 */
 
 	isb(); /* Ensure counters have been stopped */
 
-	for (i = 0U; i < amcgcr_el0_cg0nc; i++) {
+	mask = ctx->group0_save;
+	while (mask != 0U) {
+		i = amu_next_counter(&mask);
 		ctx->group0_cnts[i] = amu_group0_cnt_read(i);
 	}
 
 #if ENABLE_AMU_AUXILIARY_COUNTERS
-	for (i = 0U; i < amcgcr_el0_cg1nc; i++) {
+	mask = ctx->group1_save;
+	while (mask != 0U) {
+		i = amu_next_counter(&mask);
 		ctx->group1_cnts[i] = amu_group1_cnt_read(i);
 	}
 #endif
@@ -495,21 +575,17 @@ static void *amu_context_save(const void *arg)
 	 */
 
 	if (hcr_el2_amvoffen != 0U) {
-		for (i = 0U, j = 0U; i < amcgcr_el0_cg0nc; i++) {
-			if (!amu_group0_voffset_supported(i)) {
-				continue; /* No virtual offset */
-			}
-
-			ctx->group0_voffsets[j++] = amu_group0_voffset_read(i);
+		mask = ctx->group0_save_voff;
+		while (mask != 0U) {
+			i = amu_next_counter(&mask);
+			ctx->group0_voffsets[i] = amu_group0_voffset_read(i);
 		}
 
 #if ENABLE_AMU_AUXILIARY_COUNTERS
-		for (i = 0U, j = 0U; i < amcgcr_el0_cg1nc; i++) {
-			if ((amcg1idr_el0_voff >> i) & 1U) {
-				continue; /* No virtual offset */
-			}
-
-			ctx->group1_voffsets[j++] = amu_group1_voffset_read(i);
+		mask = ctx->group1_save_voff;
+		while (mask != 0U) {
+			i = amu_next_counter(&mask);
+			ctx->group1_voffsets[i] = amu_group1_voffset_read(i);
 		}
 #endif
 	}
@@ -519,20 +595,13 @@ static void *amu_context_save(const void *arg)
 
 static void *amu_context_restore(const void *arg)
 {
-	uint64_t i, j;
-
 	unsigned int core_pos;
 	struct amu_ctx *ctx;
+	unsigned int mask, i;
 
 	uint64_t hcr_el2_amvoffen = 0;	/* AMU virtual offsets enabled */
 
 	uint64_t amcfgr_el0_ncg;	/* Number of counter groups */
-	uint64_t amcgcr_el0_cg0nc;	/* Number of group 0 counters */
-
-#if ENABLE_AMU_AUXILIARY_COUNTERS
-	uint64_t amcgcr_el0_cg1nc;	/* Number of group 1 counters */
-	uint64_t amcg1idr_el0_voff;	/* Auxiliary counters with virtual offsets */
-#endif
 
 	if (!is_feat_amu_supported()) {
 		return (void *)0;
@@ -542,17 +611,11 @@ static void *amu_context_restore(const void *arg)
 	ctx = &amu_ctxs_[core_pos];
 
 	amcfgr_el0_ncg = read_amcfgr_el0_ncg();
-	amcgcr_el0_cg0nc = read_amcgcr_el0_cg0nc();
 
 	if (is_feat_amuv1p1_supported()) {
 		hcr_el2_amvoffen = read_hcr_el2_amvoffen();
 	}
 
-#if ENABLE_AMU_AUXILIARY_COUNTERS
-	amcgcr_el0_cg1nc = (amcfgr_el0_ncg > 0U) ? read_amcgcr_el0_cg1nc() : 0U;
-	amcg1idr_el0_voff = (hcr_el2_amvoffen != 0U) ? read_amcg1idr_el0_voff() : 0U;
-#endif
-
 	/*
 	 * Sanity check that all counters were disabled when the context was
 	 * previously saved.
@@ -565,43 +628,42 @@ static void *amu_context_restore(const void *arg)
 	}
 
 	/*
-	 * Restore the counter values from the local context.
+	 * Restore the counter values, and virtual offsets, saved in the local
+	 * context. A single ISB after all the writes is enough.
 	 */
 
-	for (i = 0U; i < amcgcr_el0_cg0nc; i++) {
+	mask = ctx->group0_save;
+	while (mask != 0U) {
+		i = amu_next_counter(&mask);
 		amu_group0_cnt_write(i, ctx->group0_cnts[i]);
 	}
 
 #if ENABLE_AMU_AUXILIARY_COUNTERS
-	for (i = 0U; i < amcgcr_el0_cg1nc; i++) {
+	mask = ctx->group1_save;
+	while (mask != 0U) {
+		i = amu_next_counter(&mask);
 		amu_group1_cnt_write(i, ctx->group1_cnts[i]);
 	}
 #endif
 
-	/*
-	 * Restore virtual offsets for counters that offer them.
-	 */
-
 	if (hcr_el2_amvoffen != 0U) {
-		for (i = 0U, j = 0U; i < amcgcr_el0_cg0nc; i++) {
-			if (!amu_group0_voffset_supported(i)) {
-				continue; /* No virtual offset */
-			}
-
-			amu_group0_voffset_write(i, ctx->group0_voffsets[j++]);
+		mask = ctx->group0_save_voff;
+		while (mask != 0U) {
+			i = amu_next_counter(&mask);
+			amu_group0_voffset_write(i, ctx->group0_voffsets[i]);
 		}
 
 #if ENABLE_AMU_AUXILIARY_COUNTERS
-		for (i = 0U, j = 0U; i < amcgcr_el0_cg1nc; i++) {
-			if ((amcg1idr_el0_voff >> i) & 1U) {
-				continue; /* No virtual offset */
-			}
-
-			amu_group1_voffset_write(i, ctx->group1_voffsets[j++]);
+		mask = ctx->group1_save_voff;
+		while (mask != 0U) {
+			i = amu_next_counter(&mask);
+			amu_group1_voffset_write(i, ctx->group1_voffsets[i]);
 		}
 #endif
 	}
 
+	isb();
+
 	/*
 	 * Re-enable counters that were disabled during context save.
 	 */
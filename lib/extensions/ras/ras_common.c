@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited and Contributors. All rights reserved.
  * Copyright (c) 2020, NVIDIA Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -13,6 +13,7 @@
 #include <common/debug.h>
 #include <lib/extensions/ras.h>
 #include <lib/extensions/ras_arch.h>
+#include <lib/extensions/ras_log.h>
 #include <plat/common/platform.h>
 
 #ifndef PLAT_RAS_PRI
@@ -87,15 +88,29 @@ int ras_ea_handler(unsigned int ea_reason, uint64_t syndrome, void *cookie,
 			if (info->probe(info, &probe_data) == 0)
 				break;
 
+#if RAS_ERROR_LOG
+			/* Log the error before the handler clears the record */
+			(void) ras_log_ser(info, probe_data, &err_data);
+#endif
+
 			/* Handle error */
 			ret = info->handler(info, probe_data, &err_data);
-			if (ret != 0)
+			if (ret != 0) {
+#if RAS_ERROR_LOG
+				ras_log_notify();
+#endif
 				return ret;
+			}
 
 			n_handled++;
 		}
 	}
 
+#if RAS_ERROR_LOG
+	if (n_handled != 0U)
+		ras_log_notify();
+#endif
+
 	return (n_handled != 0U) ? 1 : 0;
 }
 
@@ -162,6 +177,11 @@ static int ras_interrupt_handler(uint32_t intr_raw, uint32_t flags,
 	if (selected->err_record->probe != NULL) {
 		ret = selected->err_record->probe(selected->err_record, &probe_data);
 		assert(ret != 0);
+
+#if RAS_ERROR_LOG
+		/* Log the error before the handler clears the record */
+		(void) ras_log_ser(selected->err_record, probe_data, &err_data);
+#endif
 	}
 
 	/* Call error handler for the record group */
@@ -169,6 +189,20 @@ static int ras_interrupt_handler(uint32_t intr_raw, uint32_t flags,
 	(void) selected->err_record->handler(selected->err_record, probe_data,
 			&err_data);
 
+#if RAS_ERROR_LOG
+	/*
+	 * The SDEI event used to report the logged errors has a lower priority
+	 * than PLAT_RAS_PRI, so it can only be dispatched once the RAS
+	 * interrupt has ended. End it here unless the handler has already done
+	 * so, in which case the handler may have dispatched an SDEI event of
+	 * its own and the report is left for the next error handled.
+	 */
+	if (plat_ic_get_running_priority() == PLAT_RAS_PRI) {
+		plat_ic_end_of_interrupt(intr_raw);
+		ras_log_notify();
+	}
+#endif
+
 	return 0;
 }
 
@@ -181,4 +215,8 @@ void __init ras_init(void)
 
 	/* Register RAS priority handler */
 	ehf_register_priority_handler(PLAT_RAS_PRI, ras_interrupt_handler);
+
+#if RAS_ERROR_LOG
+	ras_log_init();
+#endif
 }
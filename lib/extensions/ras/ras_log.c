@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Log of the errors handled by the RAS framework, kept in a ring shared with
+ * the Non-secure world so that it can consume the errors in bulk instead of
+ * EL3 printing each of them on the console.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <arch_helpers.h>
+#include <bl31/ea_handle.h>
+#include <common/debug.h>
+#include <lib/extensions/ras.h>
+#include <lib/extensions/ras_arch.h>
+#include <lib/extensions/ras_log.h>
+#include <lib/spinlock.h>
+#include <lib/utils.h>
+#include <services/sdei.h>
+#include <smccc_helpers.h>
+
+#include <platform_def.h>
+
+#if !defined(PLAT_RAS_LOG_BASE) || !defined(PLAT_RAS_LOG_SIZE)
+# error Platform must define the RAS error log buffer
+#endif
+
+/* Default number of entries logged before the consumer is notified */
+#ifdef PLAT_RAS_LOG_BATCH
+#define RAS_LOG_DEFAULT_BATCH		PLAT_RAS_LOG_BATCH
+#else
+#define RAS_LOG_DEFAULT_BATCH		1U
+#endif
+
+#define RAS_LOG_NUM_ENTRIES \
+	((PLAT_RAS_LOG_SIZE - sizeof(struct ras_log_header)) / \
+	 sizeof(struct ras_log_entry))
+
+CASSERT(PLAT_RAS_LOG_SIZE >= (sizeof(struct ras_log_header) +
+			      sizeof(struct ras_log_entry)),
+	assert_ras_log_size);
+CASSERT((RAS_LOG_DEFAULT_BATCH >= 1U) &&
+	(RAS_LOG_DEFAULT_BATCH <= RAS_LOG_NUM_ENTRIES),
+	assert_ras_log_batch);
+
+static struct ras_log_header *const ras_log_hdr =
+	(struct ras_log_header *)PLAT_RAS_LOG_BASE;
+static struct ras_log_entry *const ras_log_entries =
+	(struct ras_log_entry *)(PLAT_RAS_LOG_BASE +
+				 sizeof(struct ras_log_header));
+
+/*
+ * Serialises the producers, which all run in EL3. The lock is only held while
+ * an entry is copied into the ring.
+ */
+static spinlock_t ras_log_lock;
+
+/*
+ * Private copies of the counters published in the header, which the
+ * Non-secure world could overwrite.
+ */
+static uint64_t ras_log_head;
+static uint64_t ras_log_dropped;
+
+/* Value of 'ras_log_head' when the consumer was last notified */
+static uint64_t ras_log_notified;
+
+/* Set when an uncorrected error is logged or dropped */
+static bool ras_log_urgent;
+
+static unsigned int ras_log_batch = RAS_LOG_DEFAULT_BATCH;
+
+static uint8_t ras_log_severity(uint64_t status)
+{
+	if (ERR_STATUS_GET_FIELD(status, UE) != 0U) {
+		/* Uncontainable errors are fatal, others may be recovered */
+		return (ERR_STATUS_GET_FIELD(status, UET) == 0U) ?
+			RAS_LOG_SEV_FATAL : RAS_LOG_SEV_RECOVERABLE;
+	}
+
+	if (ERR_STATUS_GET_FIELD(status, DE) != 0U) {
+		return RAS_LOG_SEV_RECOVERABLE;
+	}
+
+	if (ERR_STATUS_GET_FIELD(status, CE) != 0U) {
+		return RAS_LOG_SEV_CORRECTED;
+	}
+
+	return RAS_LOG_SEV_INFORMATIONAL;
+}
+
+static void ras_log_add(struct ras_log_entry *entry)
+{
+	uint64_t tail;
+
+	spin_lock(&ras_log_lock);
+
+	if ((entry->severity == RAS_LOG_SEV_FATAL) ||
+	    (entry->severity == RAS_LOG_SEV_RECOVERABLE)) {
+		ras_log_urgent = true;
+	}
+
+	tail = *(volatile uint64_t *)&ras_log_hdr->tail;
+	if ((ras_log_head - tail) >= RAS_LOG_NUM_ENTRIES) {
+		ras_log_dropped++;
+		ras_log_hdr->dropped = ras_log_dropped;
+		spin_unlock(&ras_log_lock);
+		return;
+	}
+
+	/* Order the read of 'tail' before the overwrite of the free slot. */
+	dmbish();
+
+	entry->seq = (uint32_t)ras_log_head;
+	ras_log_entries[ras_log_head % RAS_LOG_NUM_ENTRIES] = *entry;
+
+	/* Publish the entry once its content is visible. */
+	dmbish();
+	ras_log_head++;
+	ras_log_hdr->head = ras_log_head;
+
+	spin_unlock(&ras_log_lock);
+}
+
+/*
+ * Log the error recorded in the Standard Error Record 'probe_data' of the group
+ * 'info', as found by its probe function, and return its ERR<n>STATUS. The
+ * record is not cleared, so that the caller can do so once it has handled the
+ * error.
+ */
+uint64_t ras_log_ser(const struct err_record_info *info, int probe_data,
+		const struct err_handler_data *const data)
+{
+	struct ras_log_entry entry;
+	unsigned int idx = (unsigned int)probe_data;
+
+	assert(info != NULL);
+	assert(data != NULL);
+
+	zeromem(&entry, sizeof(entry));
+
+	if (info->access == ERR_ACCESS_MEMMAP) {
+		entry.flags = RAS_LOG_FLAG_MEMMAP;
+		entry.node = info->memmap.base_addr;
+		entry.status = ser_get_status(info->memmap.base_addr, idx);
+		if (ERR_STATUS_GET_FIELD(entry.status, AV) != 0U) {
+			entry.addr = ser_get_addr(info->memmap.base_addr, idx);
+		}
+		if (ERR_STATUS_GET_FIELD(entry.status, MV) != 0U) {
+			entry.misc0 = ser_get_misc0(info->memmap.base_addr,
+						    idx);
+		}
+	} else {
+		/* The record in error has been selected by the probe */
+		entry.node = info->sysreg.idx_start;
+		entry.status = read_erxstatus_el1();
+		if (ERR_STATUS_GET_FIELD(entry.status, AV) != 0U) {
+			entry.addr = read_erxaddr_el1();
+		}
+		if (ERR_STATUS_GET_FIELD(entry.status, MV) != 0U) {
+			entry.misc0 = read_erxmisc0_el1();
+		}
+	}
+
+	if (ERR_STATUS_GET_FIELD(entry.status, AV) != 0U) {
+		entry.flags |= RAS_LOG_FLAG_ADDR_VALID;
+	}
+	if (ERR_STATUS_GET_FIELD(entry.status, MV) != 0U) {
+		entry.flags |= RAS_LOG_FLAG_MISC_VALID;
+	}
+
+	entry.severity = ras_log_severity(entry.status);
+	entry.record = idx;
+	if (data->interrupt != 0U) {
+		entry.reason = ERROR_INTERRUPT;
+		entry.cause = data->interrupt;
+	} else {
+		entry.reason = (uint8_t)data->ea_reason;
+		entry.cause = data->syndrome;
+	}
+	entry.mpidr = read_mpidr_el1();
+	entry.timestamp = read_cntpct_el0();
+
+	ras_log_add(&entry);
+
+	return entry.status;
+}
+
+/*
+ * Notify the consumer if enough entries have been logged since the last
+ * notification, or if an uncorrected error has been logged. Called by the RAS
+ * framework once all the records in error have been handled, so that errors
+ * handled together are reported together, and for RAS interrupts once the
+ * interrupt has ended, so that the SDEI event can be dispatched.
+ */
+void ras_log_notify(void)
+{
+	bool notify;
+
+	spin_lock(&ras_log_lock);
+	notify = ras_log_urgent ||
+		 ((ras_log_head - ras_log_notified) >= ras_log_batch);
+	if (notify) {
+		ras_log_notified = ras_log_head;
+		ras_log_urgent = false;
+	}
+	spin_unlock(&ras_log_lock);
+
+#if SDEI_SUPPORT && defined(PLAT_RAS_LOG_SDEI_EVENT)
+	if (notify && (sdei_dispatch_event(PLAT_RAS_LOG_SDEI_EVENT) != 0)) {
+		VERBOSE("RAS log: failed to dispatch SDEI event %d\n",
+			PLAT_RAS_LOG_SDEI_EVENT);
+	}
+#endif
+}
+
+void ras_log_init(void)
+{
+	zeromem(ras_log_hdr, sizeof(*ras_log_hdr));
+
+	ras_log_hdr->magic = RAS_LOG_MAGIC;
+	ras_log_hdr->version = RAS_LOG_VERSION;
+	ras_log_hdr->entry_size = (uint16_t)sizeof(struct ras_log_entry);
+	ras_log_hdr->num_entries = (uint32_t)RAS_LOG_NUM_ENTRIES;
+}
+
+/*
+ * This function is responsible for handling all RAS error log SMC calls from
+ * the Non-secure world.
+ */
+uintptr_t ras_log_smc_handler(unsigned int smc_fid,
+			      u_register_t x1,
+			      u_register_t x2,
+			      u_register_t x3,
+			      u_register_t x4,
+			      void *cookie,
+			      void *handle,
+			      u_register_t flags)
+{
+	u_register_t event = 0U;
+
+	switch (smc_fid) {
+	case RAS_LOG_SMC_GET_INFO:
+		/*
+		 * x0 --> error code.
+		 * x1 --> physical address of the ring.
+		 * x2 --> size of the ring in bytes.
+		 * x3 --> number of entries logged before a notification.
+		 * x4 --> SDEI event used for notifications, 0 if none.
+		 */
+#if SDEI_SUPPORT && defined(PLAT_RAS_LOG_SDEI_EVENT)
+		event = PLAT_RAS_LOG_SDEI_EVENT;
+#endif
+		SMC_RET5(handle, RAS_LOG_E_SUCCESS, PLAT_RAS_LOG_BASE,
+			 PLAT_RAS_LOG_SIZE, ras_log_batch, event);
+
+	case RAS_LOG_SMC_SET_BATCH:
+		/*
+		 * x1 <-- number of entries logged before a notification.
+		 *        Uncorrected errors are always notified at once.
+		 * x0 --> error code.
+		 */
+		if ((x1 == 0U) || (x1 > RAS_LOG_NUM_ENTRIES)) {
+			SMC_RET1(handle, RAS_LOG_E_INVALID_PARAMS);
+		}
+
+		spin_lock(&ras_log_lock);
+		ras_log_batch = (unsigned int)x1;
+		spin_unlock(&ras_log_lock);
+		SMC_RET1(handle, RAS_LOG_E_SUCCESS);
+
+	default:
+		break;
+	}
+
+	SMC_RET1(handle, SMC_UNK);
+}
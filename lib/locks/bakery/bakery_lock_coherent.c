@@ -10,6 +10,7 @@
 #include <arch_helpers.h>
 #include <lib/bakery_lock.h>
 #include <lib/el3_runtime/cpu_data.h>
+#include <lib/lock_stats.h>
 #include <plat/common/platform.h>
 
 /*
@@ -94,6 +95,8 @@ void bakery_lock_get(bakery_lock_t *bakery)
 	unsigned int they, me;
 	unsigned int my_ticket, my_prio, their_ticket;
 	unsigned int their_bakery_data;
+	bool contended = false;
+	uint64_t start = lock_stats_wait_start();
 
 	me = plat_my_core_pos();
 
@@ -129,6 +132,7 @@ void bakery_lock_get(bakery_lock_t *bakery)
 			 * to have it dropped to 0; or drop and probably content
 			 * again for the same lock to have an even higher value)
 			 */
+			contended = true;
 			do {
 				wfe();
 			} while (their_ticket ==
@@ -142,6 +146,8 @@ void bakery_lock_get(bakery_lock_t *bakery)
 	 * acquired.
 	 */
 	dmbish();
+
+	lock_stats_acquired(bakery, start, contended);
 }
 
 
@@ -153,6 +159,8 @@ void bakery_lock_release(bakery_lock_t *bakery)
 	assert_bakery_entry_valid(me, bakery);
 	assert(bakery_ticket_number(bakery->lock_data[me]) != 0U);
 
+	lock_stats_released(bakery);
+
 	/*
 	 * Ensure that other observers see any stores in the critical section
 	 * before releasing the lock. Also ensure all loads in the critical
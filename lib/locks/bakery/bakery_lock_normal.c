@@ -11,6 +11,7 @@
 #include <arch_helpers.h>
 #include <lib/bakery_lock.h>
 #include <lib/el3_runtime/cpu_data.h>
+#include <lib/lock_stats.h>
 #include <lib/utils_def.h>
 #include <plat/common/platform.h>
 
@@ -169,6 +170,8 @@ void bakery_lock_get(bakery_lock_t *lock)
 	bakery_info_t *their_bakery_info;
 	unsigned int their_bakery_data;
 	bool is_cached;
+	bool contended = false;
+	uint64_t start = lock_stats_wait_start();
 
 	me = plat_my_core_pos();
 	is_cached = is_dcache_enabled();
@@ -210,6 +213,7 @@ void bakery_lock_get(bakery_lock_t *lock)
 			 * to have it dropped to 0; or drop and probably content
 			 * again for the same lock to have an even higher value)
 			 */
+			contended = true;
 			do {
 				wfe();
 				read_cache_op((uintptr_t)their_bakery_info, is_cached);
@@ -224,6 +228,8 @@ void bakery_lock_get(bakery_lock_t *lock)
 	 * acquired.
 	 */
 	dmbish();
+
+	lock_stats_acquired(lock, start, contended);
 }
 
 void bakery_lock_release(bakery_lock_t *lock)
@@ -235,6 +241,8 @@ void bakery_lock_release(bakery_lock_t *lock)
 
 	assert(is_lock_acquired(my_bakery_info, is_cached));
 
+	lock_stats_released(lock);
+
 	/*
 	 * Ensure that other observers see any stores in the critical section
 	 * before releasing the lock. Also ensure all loads in the critical
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Multicore lock throughput benchmark. The Non-secure world calls
+ * LOCK_BENCH_SMC_RUN on several CPUs at once, each call acquiring and releasing
+ * the same EL3 lock a number of times, and derives the throughput of the lock
+ * from the time taken and the number of acquisitions made by all the CPUs.
+ */
+
+#include <arch_helpers.h>
+#include <lib/bakery_lock.h>
+#include <lib/lock_bench.h>
+#include <lib/spinlock.h>
+#include <smccc_helpers.h>
+
+/*
+ * The bakery lock is implemented as selected by the build, e.g. as a ticket
+ * lock with USE_TICKET_LOCK=1, as for the PSCI power domain locks.
+ */
+DEFINE_BAKERY_LOCK(lock_bench_bakery_lock);
+static spinlock_t lock_bench_spin_lock;
+
+/* Acquisitions made by all CPUs, updated with the lock being exercised held */
+static uint64_t lock_bench_count;
+
+static void lock_bench_get(unsigned int lock)
+{
+	if (lock == LOCK_BENCH_LOCK_BAKERY) {
+		bakery_lock_get(&lock_bench_bakery_lock);
+	} else {
+		spin_lock(&lock_bench_spin_lock);
+	}
+}
+
+static void lock_bench_release(unsigned int lock)
+{
+	if (lock == LOCK_BENCH_LOCK_BAKERY) {
+		bakery_lock_release(&lock_bench_bakery_lock);
+	} else {
+		spin_unlock(&lock_bench_spin_lock);
+	}
+}
+
+/*
+ * Acquire and release 'lock' 'iterations' times, holding it for 'hold' system
+ * counter ticks each time, and return the time taken in system counter ticks.
+ * '*count' is set to the total number of acquisitions made so far by all CPUs,
+ * as seen by the last acquisition of this call.
+ */
+static uint64_t lock_bench_run(unsigned int lock, uint32_t iterations,
+			       uint32_t hold, uint64_t *count)
+{
+	uint64_t start, held;
+	uint32_t i;
+
+	start = read_cntpct_el0();
+
+	for (i = 0U; i < iterations; i++) {
+		lock_bench_get(lock);
+
+		lock_bench_count++;
+		*count = lock_bench_count;
+
+		held = read_cntpct_el0();
+		while ((read_cntpct_el0() - held) < hold) {
+			;
+		}
+
+		lock_bench_release(lock);
+	}
+
+	return read_cntpct_el0() - start;
+}
+
+/*
+ * This function is responsible for handling all lock benchmark SMC calls from
+ * the Non-secure world.
+ */
+uintptr_t lock_bench_smc_handler(unsigned int smc_fid,
+				 u_register_t x1,
+				 u_register_t x2,
+				 u_register_t x3,
+				 u_register_t x4,
+				 void *cookie,
+				 void *handle,
+				 u_register_t flags)
+{
+	uint64_t elapsed, count = 0U;
+
+	switch (smc_fid) {
+	case LOCK_BENCH_SMC_RUN:
+		/*
+		 * x1 <-- lock to exercise, LOCK_BENCH_LOCK_*.
+		 * x2 <-- number of acquisitions.
+		 * x3 <-- hold time of each acquisition, in system counter
+		 *        ticks.
+		 * x0 --> error code.
+		 * x1 --> time taken, in system counter ticks.
+		 * x2 --> number of acquisitions made so far by all CPUs.
+		 */
+		if ((x1 > LOCK_BENCH_LOCK_SPIN) || (x2 == 0U) ||
+		    (x2 > LOCK_BENCH_MAX_ITERATIONS) ||
+		    (x3 > LOCK_BENCH_MAX_HOLD_TICKS)) {
+			SMC_RET1(handle, LOCK_BENCH_E_INVALID_PARAMS);
+		}
+
+		elapsed = lock_bench_run((unsigned int)x1, (uint32_t)x2,
+					 (uint32_t)x3, &count);
+		SMC_RET3(handle, LOCK_BENCH_E_SUCCESS, elapsed, count);
+
+	default:
+		break;
+	}
+
+	SMC_RET1(handle, SMC_UNK);
+}
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <lib/cassert.h>
+#include <lib/lock_stats.h>
+#include <lib/spinlock.h>
+#include <lib/utils.h>
+
+/*
+ * Lock statistics are kept in a fixed size table, indexed by lock address
+ * through an open addressing hash table. Entries are created the first time a
+ * lock is registered or acquired and are never removed, so lookups can probe
+ * the hash table without taking any lock.
+ *
+ * All the counters of an entry are updated by the CPU holding the lock the
+ * entry describes, which serialises the updates. Samples taken while the data
+ * cache is disabled are dropped, as the table lives in normal cacheable
+ * memory and would otherwise be corrupted by non-coherent accesses.
+ */
+static lock_stats_t lock_stats_table[LOCK_STATS_MAX_LOCKS];
+static volatile unsigned int lock_stats_num;
+
+/*
+ * Slots of the hash table hold the index of an entry plus one, or 0 when
+ * free. The hash table is kept at most half full so that probe sequences are
+ * short and always end on a free slot.
+ */
+#define LOCK_STATS_HASH_SIZE	(2U * LOCK_STATS_MAX_LOCKS)
+
+CASSERT(LOCK_STATS_MAX_LOCKS < UINT16_MAX, assert_lock_stats_max_locks);
+
+static volatile uint16_t lock_stats_hash[LOCK_STATS_HASH_SIZE];
+
+/* Serialises the creation of new entries. Taken through the raw function. */
+static spinlock_t lock_stats_table_lock;
+
+static bool lock_stats_overflow_reported;
+
+static unsigned int lock_stats_hash_slot(const void *lock)
+{
+	/* Locks are at least word aligned */
+	uintptr_t key = (uintptr_t)lock >> 2;
+
+	return (unsigned int)((key ^ (key >> 9)) % LOCK_STATS_HASH_SIZE);
+}
+
+static lock_stats_t *lock_stats_find(const void *lock)
+{
+	unsigned int slot = lock_stats_hash_slot(lock);
+	unsigned int idx;
+
+	while ((idx = lock_stats_hash[slot]) != 0U) {
+		if (lock_stats_table[idx - 1U].lock == lock) {
+			return &lock_stats_table[idx - 1U];
+		}
+
+		slot = (slot + 1U) % LOCK_STATS_HASH_SIZE;
+	}
+
+	return NULL;
+}
+
+static lock_stats_t *lock_stats_find_or_create(const void *lock)
+{
+	lock_stats_t *entry = lock_stats_find(lock);
+	unsigned int slot;
+
+	if (entry != NULL) {
+		return entry;
+	}
+
+	(spin_lock)(&lock_stats_table_lock);
+
+	/* Check again, another CPU may have created the entry meanwhile */
+	entry = lock_stats_find(lock);
+	if (entry == NULL) {
+		if (lock_stats_num < LOCK_STATS_MAX_LOCKS) {
+			entry = &lock_stats_table[lock_stats_num];
+			zeromem(entry, sizeof(*entry));
+			entry->lock = lock;
+
+			slot = lock_stats_hash_slot(lock);
+			while (lock_stats_hash[slot] != 0U) {
+				slot = (slot + 1U) % LOCK_STATS_HASH_SIZE;
+			}
+
+			/* Publish the entry once it is fully initialised */
+			dmbish();
+			lock_stats_num++;
+			lock_stats_hash[slot] = (uint16_t)lock_stats_num;
+		} else if (!lock_stats_overflow_reported) {
+			lock_stats_overflow_reported = true;
+			WARN("Lock stats: more than %u locks, ignoring %p\n",
+			     LOCK_STATS_MAX_LOCKS, lock);
+		}
+	}
+
+	(spin_unlock)(&lock_stats_table_lock);
+
+	return entry;
+}
+
+uint64_t lock_stats_wait_start(void)
+{
+	return read_cntpct_el0();
+}
+
+/*
+ * Associate a symbolic name to a lock. The name must remain valid for the
+ * lifetime of BL31.
+ */
+void lock_stats_register(const void *lock, const char *name)
+{
+	lock_stats_t *entry;
+
+	assert(lock != NULL);
+
+	if (!is_dcache_enabled()) {
+		return;
+	}
+
+	entry = lock_stats_find_or_create(lock);
+	if (entry != NULL) {
+		entry->name = name;
+	}
+}
+
+/*
+ * Record an acquisition of 'lock'. Must be called by the new holder, after the
+ * lock has been acquired. 'wait_start' is the value returned by
+ * lock_stats_wait_start() before attempting to acquire the lock.
+ */
+void lock_stats_acquired(const void *lock, uint64_t wait_start,
+			 bool contended)
+{
+	lock_stats_t *entry;
+	uint64_t now, wait;
+
+	if (!is_dcache_enabled()) {
+		return;
+	}
+
+	now = read_cntpct_el0();
+
+	entry = lock_stats_find_or_create(lock);
+	if (entry == NULL) {
+		return;
+	}
+
+	wait = now - wait_start;
+
+	entry->acquire_count++;
+	if (contended) {
+		entry->contended_count++;
+	}
+	entry->wait_total += wait;
+	if (wait > entry->wait_max) {
+		entry->wait_max = wait;
+	}
+	entry->hold_start = now;
+}
+
+/*
+ * Record the release of 'lock'. Must be called by the holder, before the lock
+ * is released.
+ */
+void lock_stats_released(const void *lock)
+{
+	lock_stats_t *entry;
+	uint64_t hold;
+
+	if (!is_dcache_enabled()) {
+		return;
+	}
+
+	entry = lock_stats_find(lock);
+	if ((entry == NULL) || (entry->hold_start == 0ULL)) {
+		return;
+	}
+
+	hold = read_cntpct_el0() - entry->hold_start;
+	entry->hold_start = 0ULL;
+
+	entry->hold_total += hold;
+	if (hold > entry->hold_max) {
+		entry->hold_max = hold;
+	}
+}
+
+void lock_stats_spin_lock(spinlock_t *lock)
+{
+	uint64_t start = lock_stats_wait_start();
+	bool contended = !spin_trylock(lock);
+
+	if (contended) {
+		(spin_lock)(lock);
+	}
+
+	lock_stats_acquired(lock, start, contended);
+}
+
+void lock_stats_spin_unlock(spinlock_t *lock)
+{
+	lock_stats_released(lock);
+	(spin_unlock)(lock);
+}
+
+unsigned int lock_stats_get_num_locks(void)
+{
+	return lock_stats_num;
+}
+
+const lock_stats_t *lock_stats_get(unsigned int idx)
+{
+	if (idx >= lock_stats_num) {
+		return NULL;
+	}
+
+	return &lock_stats_table[idx];
+}
+
+/*
+ * Clear the counters of all the tracked locks. Lock addresses and names are
+ * preserved. This races with concurrent updates, which only affects the
+ * accuracy of the next samples.
+ */
+void lock_stats_reset(void)
+{
+	unsigned int i, num = lock_stats_num;
+
+	for (i = 0U; i < num; i++) {
+		lock_stats_table[i].acquire_count = 0ULL;
+		lock_stats_table[i].contended_count = 0ULL;
+		lock_stats_table[i].wait_total = 0ULL;
+		lock_stats_table[i].wait_max = 0ULL;
+		lock_stats_table[i].hold_total = 0ULL;
+		lock_stats_table[i].hold_max = 0ULL;
+	}
+}
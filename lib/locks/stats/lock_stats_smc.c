@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+
+#include <lib/lock_stats.h>
+#include <smccc_helpers.h>
+
+/*
+ * Pack up to the first 16 characters of a lock name into two registers, first
+ * character in the least significant byte of the first register.
+ */
+static void lock_stats_pack_name(const char *name, u_register_t regs[2])
+{
+	regs[0] = 0U;
+	regs[1] = 0U;
+
+	if (name != NULL) {
+		(void)memcpy(regs, name,
+			     strnlen(name, sizeof(u_register_t) * 2U));
+	}
+}
+
+/*
+ * Identify the name of lock 'idx' by the index of the first lock registered
+ * under the same name, so that the Non-secure world can aggregate the locks
+ * sharing a name without learning their EL3 addresses.
+ */
+static unsigned int lock_stats_name_id(unsigned int idx, const char *name)
+{
+	const lock_stats_t *stats;
+	unsigned int i;
+
+	if (name == NULL) {
+		return idx;
+	}
+
+	for (i = 0U; i < idx; i++) {
+		stats = lock_stats_get(i);
+		if ((stats != NULL) && (stats->name != NULL) &&
+		    (strcmp(stats->name, name) == 0)) {
+			return i;
+		}
+	}
+
+	return idx;
+}
+
+/*
+ * This function is responsible for handling all lock statistics SMC calls from
+ * the Non-secure world.
+ */
+uintptr_t lock_stats_smc_handler(unsigned int smc_fid,
+				 u_register_t x1,
+				 u_register_t x2,
+				 u_register_t x3,
+				 u_register_t x4,
+				 void *cookie,
+				 void *handle,
+				 u_register_t flags)
+{
+	const lock_stats_t *stats;
+	u_register_t name[2];
+
+	switch (smc_fid) {
+	case LOCK_STATS_SMC_GET_NUM_LOCKS:
+		/*
+		 * x0 --> error code.
+		 * x1 --> number of tracked locks.
+		 */
+		SMC_RET2(handle, LOCK_STATS_E_SUCCESS,
+			 lock_stats_get_num_locks());
+
+	case LOCK_STATS_SMC_GET_NAME:
+		/*
+		 * x1 <-- lock index.
+		 * x0 --> error code.
+		 * x1 - x2 --> first 16 characters of the lock name.
+		 * x3 --> name ID, the index of the first lock with this name.
+		 */
+		stats = lock_stats_get((unsigned int)x1);
+		if (stats == NULL) {
+			SMC_RET1(handle, LOCK_STATS_E_INVALID_PARAMS);
+		}
+
+		lock_stats_pack_name(stats->name, name);
+		SMC_RET4(handle, LOCK_STATS_E_SUCCESS, name[0], name[1],
+			 lock_stats_name_id((unsigned int)x1, stats->name));
+
+	case LOCK_STATS_SMC_GET_STATS:
+		/*
+		 * x1 <-- lock index.
+		 * x0 --> error code.
+		 * x1 --> acquire count.
+		 * x2 --> contended acquire count.
+		 * x3 --> total wait time.
+		 * x4 --> maximum wait time.
+		 * x5 --> total hold time.
+		 * x6 --> maximum hold time.
+		 * Times are in system counter ticks.
+		 */
+		stats = lock_stats_get((unsigned int)x1);
+		if (stats == NULL) {
+			SMC_RET1(handle, LOCK_STATS_E_INVALID_PARAMS);
+		}
+
+		SMC_RET7(handle, LOCK_STATS_E_SUCCESS, stats->acquire_count,
+			 stats->contended_count, stats->wait_total,
+			 stats->wait_max, stats->hold_total, stats->hold_max);
+
+	case LOCK_STATS_SMC_RESET:
+		lock_stats_reset();
+		SMC_RET1(handle, LOCK_STATS_E_SUCCESS);
+
+	default:
+		break;
+	}
+
+	SMC_RET1(handle, SMC_UNK);
+}
@@ -14,6 +14,7 @@
 #include <context.h>
 #include <drivers/delay_timer.h>
 #include <lib/el3_runtime/context_mgmt.h>
+#include <lib/el3_trace.h>
 #include <lib/utils.h>
 #include <plat/common/platform.h>
 
@@ -1001,6 +1002,8 @@ void psci_warmboot_entrypoint(void)
 		panic();
 	}
 
+	EL3_TRACE(EL3_TRACE_EV_PSCI_WARMBOOT, 0U, 0U, 0U);
+
 	/*
 	 * Get the maximum power domain level to traverse to after this cpu
 	 * has been physically powered up.
@@ -1196,6 +1199,28 @@ void psci_pwrdown_cpu(unsigned int power_level)
 #endif
 }
 
+/*******************************************************************************
+ * This function waits up to 'wait_ms' milliseconds for the other cores to
+ * transition to power down state. Passing '0' makes it non-blocking.
+ ******************************************************************************/
+static int psci_wait_other_cores_stopped(unsigned int wait_ms)
+{
+	/* Need to wait for other cores to shutdown */
+	if (wait_ms != 0U) {
+		while ((wait_ms-- != 0U) && (!psci_is_last_on_cpu())) {
+			mdelay(1U);
+		}
+
+		if (!psci_is_last_on_cpu()) {
+			WARN("Failed to stop all cores!\n");
+			psci_print_power_domain_map();
+			return PSCI_E_DENIED;
+		}
+	}
+
+	return PSCI_E_SUCCESS;
+}
+
 /*******************************************************************************
  * This function invokes the callback 'stop_func()' with the 'mpidr' of each
  * online PE. Caller can pass suitable method to stop a remote core.
@@ -1226,20 +1251,45 @@ int psci_stop_other_cores(unsigned int wait_ms,
 		}
 	}
 
-	/* Need to wait for other cores to shutdown */
-	if (wait_ms != 0U) {
-		while ((wait_ms-- != 0U) && (!psci_is_last_on_cpu())) {
-			mdelay(1U);
+	return psci_wait_other_cores_stopped(wait_ms);
+}
+
+/*******************************************************************************
+ * This function is the same as psci_stop_other_cores(), except that the
+ * callback 'stop_func()' is invoked with the MPIDRs of up to
+ * PSCI_STOP_CORES_BATCH online PEs at once, in core index order. This lets the
+ * caller signal them together, e.g. with one SGI generation per cluster.
+ ******************************************************************************/
+int psci_stop_other_cores_multi(unsigned int wait_ms,
+			  void (*stop_func)(const u_register_t *mpidrs,
+					    unsigned int num_mpidrs))
+{
+	u_register_t mpidrs[PSCI_STOP_CORES_BATCH];
+	unsigned int idx, this_cpu_idx, num_mpidrs = 0U;
+
+	this_cpu_idx = plat_my_core_pos();
+
+	/* Gather the online cores other than the current one */
+	for (idx = 0U; idx < psci_plat_core_count; idx++) {
+		if ((idx == this_cpu_idx) ||
+		    (psci_get_aff_info_state_by_idx(idx) != AFF_STATE_ON)) {
+			continue;
 		}
 
-		if (!psci_is_last_on_cpu()) {
-			WARN("Failed to stop all cores!\n");
-			psci_print_power_domain_map();
-			return PSCI_E_DENIED;
+		mpidrs[num_mpidrs] = psci_cpu_pd_nodes[idx].mpidr;
+		num_mpidrs++;
+
+		if (num_mpidrs == PSCI_STOP_CORES_BATCH) {
+			(*stop_func)(mpidrs, num_mpidrs);
+			num_mpidrs = 0U;
 		}
 	}
 
-	return PSCI_E_SUCCESS;
+	if (num_mpidrs != 0U) {
+		(*stop_func)(mpidrs, num_mpidrs);
+	}
+
+	return psci_wait_other_cores_stopped(wait_ms);
 }
 
 /*******************************************************************************
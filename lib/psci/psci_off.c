@@ -11,6 +11,8 @@
 #include <arch.h>
 #include <arch_helpers.h>
 #include <common/debug.h>
+#include <lib/el3_runtime/pubsub_events.h>
+#include <lib/el3_trace.h>
 #include <lib/pmf/pmf.h>
 #include <lib/runtime_instr.h>
 #include <plat/common/platform.h>
@@ -104,11 +106,15 @@ int psci_do_cpu_off(unsigned int end_pwrlvl)
 	 */
 	psci_do_state_coordination(end_pwrlvl, &state_info);
 
+	PUBLISH_EVENT(psci_cpu_off_start);
+
 #if ENABLE_PSCI_STAT
 	/* Update the last cpu for each level till end_pwrlvl */
 	psci_stats_update_pwr_down(end_pwrlvl, &state_info);
 #endif
 
+	EL3_TRACE(EL3_TRACE_EV_PSCI_PWR_DOWN, end_pwrlvl, 0U, 0U);
+
 #if ENABLE_RUNTIME_INSTRUMENTATION
 
 	/*
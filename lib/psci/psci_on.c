@@ -212,6 +212,11 @@ void psci_cpu_on_finish(unsigned int cpu_idx, const psci_power_state_t *state_in
 	/* Ensure we have been explicitly woken up by another cpu */
 	assert(psci_get_aff_info_state() == AFF_STATE_ON_PENDING);
 
+#if CTX_INCLUDE_FPREGS && CTX_LAZY_FPREGS
+	/* Drop the lazy FP/SIMD state before any context is set up again */
+	cm_fpregs_lazy_reset();
+#endif
+
 	/*
 	 * Call the cpu on finish handler registered by the Secure Payload
 	 * Dispatcher to let it do any bookeeping. If the handler encounters an
@@ -14,6 +14,7 @@
 #include <common/bl_common.h>
 #include <lib/bakery_lock.h>
 #include <lib/el3_runtime/cpu_data.h>
+#include <lib/lock_stats.h>
 #include <lib/psci/psci.h>
 #include <lib/spinlock.h>
 
@@ -50,6 +51,9 @@
 /* Invalid parent */
 #define PSCI_PARENT_NODE_INVALID	0xFFFFFFFFU
 
+/* Maximum number of cores passed at once to psci_stop_other_cores_multi() */
+#define PSCI_STOP_CORES_BATCH		32U
+
 /*
  * Helper functions to get/set the fields of PSCI per-cpu data.
  */
@@ -179,9 +183,14 @@ typedef enum suspend_mode {
 #if HW_ASSISTED_COHERENCY
 /*
  * On systems where participant CPUs are cache-coherent, we can use spinlocks
- * instead of bakery locks.
+ * instead of bakery locks. If USE_TICKET_LOCK is set, FIFO ticket locks are
+ * used so that contending CPUs are served in order.
  */
+#if USE_TICKET_LOCK
+#define DEFINE_PSCI_LOCK(_name)		DEFINE_BAKERY_LOCK(_name)
+#else
 #define DEFINE_PSCI_LOCK(_name)		spinlock_t _name
+#endif
 #define DECLARE_PSCI_LOCK(_name)	extern DEFINE_PSCI_LOCK(_name)
 
 /* One lock is required per non-CPU power domain node */
@@ -208,12 +217,20 @@ static inline void psci_dsbish(void)
 
 static inline void psci_lock_get(non_cpu_pd_node_t *non_cpu_pd_node)
 {
+#if USE_TICKET_LOCK
+	bakery_lock_get(&psci_locks[non_cpu_pd_node->lock_index]);
+#else
 	spin_lock(&psci_locks[non_cpu_pd_node->lock_index]);
+#endif
 }
 
 static inline void psci_lock_release(non_cpu_pd_node_t *non_cpu_pd_node)
 {
+#if USE_TICKET_LOCK
+	bakery_lock_release(&psci_locks[non_cpu_pd_node->lock_index]);
+#else
 	spin_unlock(&psci_locks[non_cpu_pd_node->lock_index]);
+#endif
 }
 
 #else /* if HW_ASSISTED_COHERENCY == 0 */
@@ -260,6 +277,8 @@ static inline void psci_lock_init(non_cpu_pd_node_t *non_cpu_pd_node,
 				  uint16_t idx)
 {
 	non_cpu_pd_node[idx].lock_index = idx;
+
+	lock_stats_register(&psci_locks[idx], "psci_pwr_domain");
 }
 
 /*******************************************************************************
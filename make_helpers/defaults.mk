@@ -63,6 +63,10 @@ CTX_INCLUDE_AARCH32_REGS	:= 1
 # Include FP registers in cpu context
 CTX_INCLUDE_FPREGS		:= 0
 
+# Switch the FP registers in cpu context on first use after a world switch
+# rather than on every world switch
+CTX_LAZY_FPREGS			:= 0
+
 # Include pointer authentication (ARMv8.3-PAuth) registers in cpu context. This
 # must be set to 1 if the platform wants to use this feature in the Secure
 # world. It is not needed to use it in the Non-secure world.
@@ -93,6 +97,21 @@ DISABLE_MTPMU			:= 0
 # development platforms.
 DYN_DISABLE_AUTH		:= 0
 
+# Flag to enable recording of boot stage timestamps across BL1, BL2 and BL31
+ENABLE_BOOT_TIMING		:= 0
+
+# Flag to enable usage statistics of EL3 exception priority levels
+ENABLE_EHF_STATS		:= 0
+
+# Flag to enable the per-CPU EL3 trace ring buffer
+ENABLE_EL3_TRACE		:= 0
+
+# Flag to enable the multicore EL3 lock throughput benchmark SMC
+ENABLE_LOCK_BENCH		:= 0
+
+# Flag to enable collection of EL3 lock contention and hold time statistics
+ENABLE_LOCK_STATS		:= 0
+
 # Build option to enable MPAM for lower ELs
 ENABLE_MPAM_FOR_LOWER_ELS	:= 0
 
@@ -108,6 +127,12 @@ ENABLE_PIE			:= 0
 # Flag to enable Performance Measurement Framework
 ENABLE_PMF			:= 0
 
+# Flag to route registered hot SMC function IDs directly to their handler
+ENABLE_SMC_FAST_DISPATCH	:= 0
+
+# Flag to enable per SMC function ID EL3 residency statistics
+ENABLE_SMC_STATS		:= 0
+
 # Flag to enable PSCI STATs functionality
 ENABLE_PSCI_STAT		:= 0
 
@@ -280,6 +305,9 @@ PSCI_OS_INIT_MODE		:= 0
 ENABLE_FEAT_RAS			:= 0
 RAS_FFH_SUPPORT			:= 0
 
+# Log the errors handled by the RAS framework in a ring shared with the NS world
+RAS_ERROR_LOG			:= 0
+
 # By default, BL1 acts as the reset handler, not BL31
 RESET_TO_BL31			:= 0
 
@@ -292,6 +320,12 @@ SDEI_SUPPORT			:= 0
 # True Random Number firmware Interface support
 TRNG_SUPPORT			:= 0
 
+# Refill the TRNG entropy pools when a CPU enters a power down suspend state
+TRNG_REFILL_ON_SUSPEND		:= 0
+
+# SiP service returning bulk random data from a CTR_DRBG seeded by the TRNG
+TRNG_DRBG_SUPPORT		:= 0
+
 # Check to see if Errata ABI is supported
 ERRATA_ABI_SUPPORT		:= 0
 
@@ -329,6 +363,10 @@ SPMC_AT_EL3			:= 0
 # Use SPM at S-EL2 as a default config for SPMD
 SPMD_SPM_AT_SEL2		:= 1
 
+# Flag to only switch GP registers and EL2 context for FF-A direct messages to
+# an SPMC that preserves the EL1 context
+SPMD_FAST_DIRECT_MSG		:= 0
+
 # Flag to introduce an infinite loop in BL1 just before it exits into the next
 # image. This is meant to help debugging the post-BL2 phase.
 SPIN_ON_BL1_EXIT		:= 0
@@ -417,6 +455,11 @@ SANITIZE_UB := off
 # Default: disabled
 USE_SPINLOCK_CAS := 0
 
+# Replace bakery locks and PSCI spinlocks by FIFO ticket locks. Only valid when
+# all lock participants are cache-coherent (HW_ASSISTED_COHERENCY=1).
+# Default: disabled
+USE_TICKET_LOCK := 0
+
 # Enable Link Time Optimization
 ENABLE_LTO			:= 0
 
@@ -426,6 +469,10 @@ ENABLE_LTO			:= 0
 # CTX_INCLUDE_EL2_REGS.
 CTX_INCLUDE_EL2_REGS		:= 0
 
+# Only write the EL2 registers that rarely change on world switch when the
+# value to restore differs from the one in the register.
+CTX_EL2_LAZY_RESTORE		:= 0
+
 # Enable Memory tag extension which is supported for architecture greater
 # than Armv8.5-A
 # By default it is set to "no"
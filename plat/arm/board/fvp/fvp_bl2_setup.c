@@ -9,6 +9,7 @@
 #include <common/debug.h>
 #include <common/desc_image_load.h>
 #include <drivers/arm/sp804_delay_timer.h>
+#include <lib/bl_aux_params/bl_aux_params.h>
 #include <lib/fconf/fconf.h>
 #include <lib/fconf/fconf_dyn_cfg_getter.h>
 
@@ -22,6 +23,11 @@ void bl2_early_platform_setup2(u_register_t arg0, u_register_t arg1, u_register_
 {
 	arm_bl2_early_platform_setup((uintptr_t)arg0, (meminfo_t *)arg1);
 
+#if ENABLE_BOOT_TIMING
+	/* Collect the boot timing records of BL1 */
+	bl_aux_params_parse(arg2, NULL);
+#endif
+
 	/* Initialize the platform config for future decision making */
 	fvp_config_setup();
 }
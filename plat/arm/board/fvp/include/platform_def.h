@@ -143,7 +143,7 @@
 #  define MAX_XLAT_TABLES		11
 # else
 #  define PLAT_ARM_MMAP_ENTRIES		9
-#  if USE_DEBUGFS
+#  if USE_DEBUGFS || ENABLE_EL3_TRACE
 #   if ENABLE_RME
 #    define MAX_XLAT_TABLES		9
 #   else
@@ -232,7 +232,8 @@ defined(IMAGE_BL2) && MEASURED_BOOT
  * calculated using the current BL31 PROGBITS debug size plus the sizes of
  * BL2 and BL1-RW
  */
-#define PLAT_ARM_MAX_BL31_SIZE		(UL(0x3D000) - ARM_L0_GPT_SIZE)
+#define PLAT_ARM_MAX_BL31_SIZE		(UL(0x3D000) - ARM_L0_GPT_SIZE - \
+					 ARM_BOOT_TIMING_SIZE)
 #endif /* RESET_TO_BL31 */
 
 #ifndef __aarch64__
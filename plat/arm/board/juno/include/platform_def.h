@@ -131,8 +131,18 @@
 #endif
 
 #ifdef IMAGE_BL31
-# define PLAT_ARM_MMAP_ENTRIES		8
-# define MAX_XLAT_TABLES		6
+# if TRNG_DRBG_SUPPORT
+/*
+ * Account for the buffer mapped by the TRNG DRBG service, one at a time. In the
+ * worst case it straddles a 1GB boundary, which needs two level 2 and two level
+ * 3 translation tables.
+ */
+#  define PLAT_ARM_MMAP_ENTRIES		9
+#  define MAX_XLAT_TABLES		10
+# else
+#  define PLAT_ARM_MMAP_ENTRIES		8
+#  define MAX_XLAT_TABLES		6
+# endif
 #endif
 
 #ifdef IMAGE_BL32
@@ -172,7 +182,7 @@
  * BL2 and BL1-RW.  SCP_BL2 image is loaded into the space BL31 -> BL2_BASE.
  * Hence the BL31 PROGBITS size should be >= PLAT_CSS_MAX_SCP_BL2_SIZE.
  */
-#define PLAT_ARM_MAX_BL31_SIZE		UL(0x3D000)
+#define PLAT_ARM_MAX_BL31_SIZE		(UL(0x3D000) - ARM_BOOT_TIMING_SIZE)
 
 #if JUNO_AARCH32_EL3_RUNTIME
 /*
@@ -202,7 +212,10 @@
 #elif defined(IMAGE_BL2U)
 # define PLATFORM_STACK_SIZE		UL(0x400)
 #elif defined(IMAGE_BL31)
-# if PLAT_XLAT_TABLES_DYNAMIC
+# if TRNG_DRBG_SUPPORT
+/* Seeding the mbed TLS CTR_DRBG uses over 1KB of stack */
+#  define PLATFORM_STACK_SIZE		UL(0x1000)
+# elif PLAT_XLAT_TABLES_DYNAMIC
 #  define PLATFORM_STACK_SIZE		UL(0x800)
 # else
 #  define PLATFORM_STACK_SIZE		UL(0x400)
@@ -106,3 +106,29 @@ void plat_entropy_setup(void)
 	/* Initialise the entropy source and trigger RNG generation */
 	plat_get_entropy(&dummy);
 }
+
+/*
+ * Check that a buffer passed to the TRNG DRBG service lies entirely within
+ * Non-secure DRAM. Returns 0 if it does, -1 otherwise.
+ */
+int plat_trng_drbg_validate_ns_buffer(uintptr_t base, size_t size)
+{
+	uintptr_t end = base + size - 1U;
+
+	if ((size == 0U) || (end < base)) {
+		return -1;
+	}
+
+	if ((base >= ARM_NS_DRAM1_BASE) &&
+	    (end < (ARM_NS_DRAM1_BASE + ARM_NS_DRAM1_SIZE))) {
+		return 0;
+	}
+#ifdef __aarch64__
+	if ((base >= ARM_DRAM2_BASE) &&
+	    (end < (ARM_DRAM2_BASE + ARM_DRAM2_SIZE))) {
+		return 0;
+	}
+#endif
+
+	return -1;
+}
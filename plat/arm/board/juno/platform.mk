@@ -166,13 +166,14 @@ SKIP_A57_L1_FLUSH_PWR_DWN	:=	 1
 # Do not enable SVE
 ENABLE_SVE_FOR_NS		:=	0
 
-# Enable the dynamic translation tables library.
+# Enable the dynamic translation tables library. The TRNG DRBG service uses it
+# to map the buffers of its callers.
 ifeq (${ARCH},aarch32)
     ifeq (${RESET_TO_SP_MIN},1)
         BL32_CPPFLAGS	+=	-DPLAT_XLAT_TABLES_DYNAMIC
     endif
 else
-    ifeq (${RESET_TO_BL31},1)
+    ifneq ($(filter 1,${RESET_TO_BL31} ${TRNG_DRBG_SUPPORT}),)
         BL31_CPPFLAGS	+=	-DPLAT_XLAT_TABLES_DYNAMIC
     endif
 endif
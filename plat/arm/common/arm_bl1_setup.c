@@ -12,6 +12,7 @@
 #include <bl1/bl1.h>
 #include <common/bl_common.h>
 #include <common/debug.h>
+#include <lib/boot_timing.h>
 #include <lib/fconf/fconf.h>
 #include <lib/fconf/fconf_dyn_cfg_getter.h>
 #include <lib/utils.h>
@@ -203,6 +204,11 @@ void arm_bl1_platform_setup(void)
 	assert(desc != NULL);
 	desc->ep_info.args.arg0 = fw_config_info->config_addr;
 
+#if ENABLE_BOOT_TIMING
+	/* The BL2 ep_info arg2 points to the boot timing records */
+	desc->ep_info.args.arg2 = boot_timing_get_aux_param();
+#endif
+
 #if CRYPTO_SUPPORT
 	/* Share the Mbed TLS heap info with other images */
 	arm_bl1_set_mbedtls_heap();
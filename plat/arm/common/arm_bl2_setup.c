@@ -16,6 +16,8 @@
 #include <common/desc_image_load.h>
 #include <drivers/generic_delay_timer.h>
 #include <drivers/partition/partition.h>
+#include <lib/bl_aux_params/bl_aux_params.h>
+#include <lib/boot_timing.h>
 #include <lib/fconf/fconf.h>
 #include <lib/fconf/fconf_dyn_cfg_getter.h>
 #include <lib/gpt_rme/gpt_rme.h>
@@ -41,6 +43,17 @@ static uintptr_t config_base;
  */
 CASSERT(BL2_BASE >= ARM_FW_CONFIG_LIMIT, assert_bl2_base_overflows);
 
+#if ENABLE_BOOT_TIMING
+/*
+ * The boot timing records handed over to BL31 must not overlap the boot
+ * parameters copied to ARM_BL2_MEM_DESC_BASE by arm_get_next_bl_params().
+ */
+CASSERT((PLAT_BOOT_TIMING_HANDOFF_BASE >= ARM_BL2_MEM_DESC_LIMIT) ||
+	((PLAT_BOOT_TIMING_HANDOFF_BASE + PLAT_BOOT_TIMING_HANDOFF_SIZE) <=
+	 ARM_BL2_MEM_DESC_BASE),
+	assert_boot_timing_overlaps_bl2_mem_desc);
+#endif
+
 /* Weak definitions may be overridden in specific ARM standard platform */
 #pragma weak bl2_early_platform_setup2
 #pragma weak bl2_platform_setup
@@ -91,6 +104,11 @@ void bl2_early_platform_setup2(u_register_t arg0, u_register_t arg1, u_register_
 {
 	arm_bl2_early_platform_setup((uintptr_t)arg0, (meminfo_t *)arg1);
 
+#if ENABLE_BOOT_TIMING
+	/* Collect the boot timing records of BL1 */
+	bl_aux_params_parse(arg2, NULL);
+#endif
+
 	generic_delay_timer_init();
 }
 
@@ -274,6 +292,13 @@ int arm_bl2_handle_post_image_load(unsigned int image_id)
 		break;
 #endif
 
+#if ENABLE_BOOT_TIMING
+	case BL31_IMAGE_ID:
+		/* Pass the boot timing records to BL31 through arg3 */
+		bl_mem_params->ep_info.args.arg3 = boot_timing_get_aux_param();
+		break;
+#endif
+
 	case BL33_IMAGE_ID:
 		/* BL33 expects to receive the primary CPU MPID (through r0) */
 		bl_mem_params->ep_info.args.arg0 = 0xffff & read_mpidr();
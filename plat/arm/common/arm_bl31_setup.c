@@ -11,6 +11,7 @@
 #include <common/bl_common.h>
 #include <common/debug.h>
 #include <drivers/console.h>
+#include <lib/bl_aux_params/bl_aux_params.h>
 #include <lib/debugfs.h>
 #include <lib/extensions/ras.h>
 #include <lib/gpt_rme/gpt_rme.h>
@@ -36,6 +37,13 @@ static entry_point_info_t rmm_image_ep_info;
  * is required for SOC_FW_CONFIG/TOS_FW_CONFIG passed from BL2.
  */
 CASSERT(BL31_BASE >= ARM_FW_CONFIG_LIMIT, assert_bl31_base_overflows);
+
+#if ENABLE_BOOT_TIMING
+/* BL31 must not overlap the boot timing records it inherits from BL2 */
+CASSERT(BL31_BASE >= (PLAT_BOOT_TIMING_HANDOFF_BASE +
+		      PLAT_BOOT_TIMING_HANDOFF_SIZE),
+	assert_bl31_base_overlaps_boot_timing);
+#endif
 #endif
 
 /* Weak definitions may be overridden in specific ARM standard platform */
@@ -173,6 +181,16 @@ void __init arm_bl31_early_platform_setup(void *from_bl2, uintptr_t soc_fw_confi
 
 #else /* RESET_TO_BL31 */
 
+#if ENABLE_BOOT_TIMING
+	/*
+	 * 'plat_params_from_bl2' points to a list of auxiliary parameters
+	 * holding the boot timing records of the previous stages, which BL2
+	 * leaves in the boot parameters area.
+	 */
+	assert((uintptr_t)plat_params_from_bl2 ==
+		PLAT_BOOT_TIMING_HANDOFF_BASE);
+	bl_aux_params_parse((u_register_t)plat_params_from_bl2, NULL);
+#else
 	/*
 	 * In debug builds, we pass a special value in 'plat_params_from_bl2'
 	 * to verify platform parameters from BL2 to BL31.
@@ -180,6 +198,7 @@ void __init arm_bl31_early_platform_setup(void *from_bl2, uintptr_t soc_fw_confi
 	 */
 	assert(((unsigned long long)plat_params_from_bl2) ==
 		ARM_BL31_PLAT_PARAM_VAL);
+#endif /* ENABLE_BOOT_TIMING */
 
 	/*
 	 * Check params passed from BL2 should not be NULL,
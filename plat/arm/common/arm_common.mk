@@ -348,6 +348,12 @@ BL31_SOURCES		+=	plat/arm/common/arm_bl31_setup.c		\
 				plat/arm/common/arm_topology.c			\
 				plat/common/plat_psci_common.c
 
+ifeq (${ENABLE_BOOT_TIMING},1)
+# Boot timing records are passed forward as BL auxiliary parameters
+BL2_SOURCES		+=	lib/bl_aux_params/bl_aux_params.c
+BL31_SOURCES		+=	lib/bl_aux_params/bl_aux_params.c
+endif
+
 ifneq ($(filter 1,${ENABLE_PMF} ${ARM_ETHOSN_NPU_DRIVER}),)
 ARM_SVC_HANDLER_SRCS :=
 
@@ -7,12 +7,21 @@
 #include <stdint.h>
 
 #include <common/debug.h>
+#include <bl31/ehf_stats.h>
+#include <bl31/smc_stats.h>
 #include <common/runtime_svc.h>
 #include <drivers/arm/ethosn.h>
+#include <lib/boot_timing.h>
 #include <lib/debugfs.h>
+#include <lib/el3_trace.h>
+#include <lib/extensions/ras_log.h>
+#include <lib/lock_bench.h>
+#include <lib/lock_stats.h>
 #include <lib/pmf/pmf.h>
+#include <lib/utils_def.h>
 #include <plat/arm/common/arm_sip_svc.h>
 #include <plat/arm/common/plat_arm.h>
+#include <services/trng_drbg.h>
 #include <tools_share/uuid.h>
 
 /* ARM SiP Service UUID */
@@ -20,6 +29,68 @@ DEFINE_SVC_UUID2(arm_sip_svc_uid,
 	0x556d75e2, 0x6033, 0xb54b, 0xb5, 0x75,
 	0x62, 0x79, 0xfd, 0x11, 0x37, 0xff);
 
+/*
+ * EL3 diagnostic and performance services. Each of them implements the
+ * 'num_calls' consecutive SMC function IDs starting at 'base_fid'.
+ */
+typedef struct arm_sip_sub_svc {
+	uint32_t base_fid;
+	uint32_t num_calls;
+	rt_svc_handle_t handle;
+} arm_sip_sub_svc_t;
+
+static const arm_sip_sub_svc_t arm_sip_sub_svcs[] = {
+#if LOCK_STATS_ENABLED
+	{ LOCK_STATS_SMC_GET_NUM_LOCKS, LOCK_STATS_NUM_SMC_CALLS,
+	  lock_stats_smc_handler },
+#endif
+#if ENABLE_SMC_STATS
+	{ SMC_STATS_SMC_GET_INFO, SMC_STATS_NUM_SMC_CALLS,
+	  smc_stats_smc_handler },
+#endif
+#if ENABLE_EL3_TRACE
+	{ EL3_TRACE_SMC_SETUP, EL3_TRACE_NUM_SMC_CALLS,
+	  el3_trace_smc_handler },
+#endif
+#if ENABLE_BOOT_TIMING && defined(IMAGE_BL31)
+	{ BOOT_TIMING_SMC_GET_INFO, BOOT_TIMING_NUM_SMC_CALLS,
+	  boot_timing_smc_handler },
+#endif
+#if ENABLE_EHF_STATS
+	{ EHF_STATS_SMC_GET_INFO, EHF_STATS_NUM_SMC_CALLS,
+	  ehf_stats_smc_handler },
+#endif
+#if TRNG_DRBG_SUPPORT
+	{ TRNG_DRBG_SMC_GET_INFO, TRNG_DRBG_NUM_SMC_CALLS,
+	  trng_drbg_smc_handler },
+#endif
+#if RAS_ERROR_LOG
+	{ RAS_LOG_SMC_GET_INFO, RAS_LOG_NUM_SMC_CALLS,
+	  ras_log_smc_handler },
+#endif
+#if ENABLE_LOCK_BENCH && defined(IMAGE_BL31)
+	{ LOCK_BENCH_SMC_RUN, LOCK_BENCH_NUM_SMC_CALLS,
+	  lock_bench_smc_handler },
+#endif
+};
+
+/* The table is empty when none of these services is enabled */
+#define ARM_SIP_SUB_SVCS_END	(arm_sip_sub_svcs + ARRAY_SIZE(arm_sip_sub_svcs))
+
+static const arm_sip_sub_svc_t *arm_sip_find_sub_svc(uint32_t smc_fid)
+{
+	const arm_sip_sub_svc_t *sub_svc;
+
+	for (sub_svc = arm_sip_sub_svcs; sub_svc < ARM_SIP_SUB_SVCS_END;
+	     sub_svc++) {
+		if ((smc_fid - sub_svc->base_fid) < sub_svc->num_calls) {
+			return sub_svc;
+		}
+	}
+
+	return NULL;
+}
+
 static int arm_sip_setup(void)
 {
 	if (pmf_setup() != 0) {
@@ -57,6 +128,7 @@ static uintptr_t arm_sip_handler(unsigned int smc_fid,
 			void *handle,
 			u_register_t flags)
 {
+	const arm_sip_sub_svc_t *sub_svc;
 	int call_count = 0;
 
 #if ENABLE_PMF
@@ -81,6 +153,20 @@ static uintptr_t arm_sip_handler(unsigned int smc_fid,
 
 #endif /* USE_DEBUGFS */
 
+	/*
+	 * Dispatch the calls of the EL3 diagnostic services to their handler,
+	 * which only serve the Non-secure world.
+	 */
+	sub_svc = arm_sip_find_sub_svc(smc_fid);
+	if (sub_svc != NULL) {
+		if (is_caller_secure(flags)) {
+			SMC_RET1(handle, ARM_SIP_SVC_E_DENIED);
+		}
+
+		return sub_svc->handle(smc_fid, x1, x2, x3, x4, cookie,
+				       handle, flags);
+	}
+
 #if ARM_ETHOSN_NPU_DRIVER
 
 	if (is_ethosn_fid(smc_fid)) {
@@ -119,6 +205,12 @@ static uintptr_t arm_sip_handler(unsigned int smc_fid,
 		call_count += ETHOSN_NUM_SMC_CALLS;
 #endif /* ARM_ETHOSN_NPU_DRIVER */
 
+		/* EL3 diagnostic services calls */
+		for (sub_svc = arm_sip_sub_svcs; sub_svc < ARM_SIP_SUB_SVCS_END;
+		     sub_svc++) {
+			call_count += (int)sub_svc->num_calls;
+		}
+
 		/* State switch call */
 		call_count += 1;
 
@@ -11,6 +11,7 @@
 #include <bl31/interrupt_mgmt.h>
 #include <drivers/arm/gic_common.h>
 #include <drivers/arm/gicv2.h>
+#include <lib/el3_trace.h>
 #include <plat/common/platform.h>
 
 /*
@@ -35,6 +36,7 @@
 #pragma weak plat_ic_set_interrupt_priority
 #pragma weak plat_ic_set_interrupt_type
 #pragma weak plat_ic_raise_el3_sgi
+#pragma weak plat_ic_raise_el3_sgi_multi
 #pragma weak plat_ic_raise_ns_sgi
 #pragma weak plat_ic_raise_s_el1_sgi
 #pragma weak plat_ic_set_spi_routing
@@ -93,7 +95,11 @@ uint32_t plat_ic_get_pending_interrupt_type(void)
  */
 uint32_t plat_ic_acknowledge_interrupt(void)
 {
-	return gicv2_acknowledge_interrupt();
+	uint32_t id = gicv2_acknowledge_interrupt();
+
+	EL3_TRACE(EL3_TRACE_EV_INTR_ACK, id, 0U, 0U);
+
+	return id;
 }
 
 /*
@@ -256,6 +262,20 @@ void plat_ic_raise_el3_sgi(int sgi_num, u_register_t target)
 #endif
 }
 
+/*
+ * GICv2 can only signal the PEs of a single SGI target list, so the targets
+ * are signalled one by one.
+ */
+void plat_ic_raise_el3_sgi_multi(int sgi_num, const u_register_t *targets,
+				 unsigned int num_targets)
+{
+	unsigned int i;
+
+	for (i = 0U; i < num_targets; i++) {
+		plat_ic_raise_el3_sgi(sgi_num, targets[i]);
+	}
+}
+
 void plat_ic_raise_ns_sgi(int sgi_num, u_register_t target)
 {
 	int id;
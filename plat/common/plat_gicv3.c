@@ -15,6 +15,7 @@
 #include <drivers/arm/gic_common.h>
 #include <drivers/arm/gicv3.h>
 #include <lib/cassert.h>
+#include <lib/el3_trace.h>
 #include <plat/common/platform.h>
 
 #ifdef IMAGE_BL31
@@ -41,6 +42,7 @@
 #pragma weak plat_ic_set_interrupt_priority
 #pragma weak plat_ic_set_interrupt_type
 #pragma weak plat_ic_raise_el3_sgi
+#pragma weak plat_ic_raise_el3_sgi_multi
 #pragma weak plat_ic_raise_ns_sgi
 #pragma weak plat_ic_raise_s_el1_sgi
 #pragma weak plat_ic_set_spi_routing
@@ -110,8 +112,14 @@ uint32_t plat_ic_get_pending_interrupt_type(void)
  */
 uint32_t plat_ic_acknowledge_interrupt(void)
 {
+	uint32_t id;
+
 	assert(IS_IN_EL3());
-	return gicv3_acknowledge_interrupt();
+	id = gicv3_acknowledge_interrupt();
+
+	EL3_TRACE(EL3_TRACE_EV_INTR_ACK, id, 0U, 0U);
+
+	return id;
 }
 
 /*
@@ -249,6 +257,24 @@ void plat_ic_raise_el3_sgi(int sgi_num, u_register_t target)
 	gicv3_raise_sgi((unsigned int)sgi_num, GICV3_G0, target);
 }
 
+void plat_ic_raise_el3_sgi_multi(int sgi_num, const u_register_t *targets,
+				 unsigned int num_targets)
+{
+	unsigned int i;
+
+	/* Targets must be valid MPIDRs in the system */
+	for (i = 0U; i < num_targets; i++) {
+		assert(plat_core_pos_by_mpidr(targets[i]) >= 0);
+	}
+
+	/* Verify that this is a secure EL3 SGI */
+	assert(plat_ic_get_interrupt_type((unsigned int)sgi_num) ==
+					  INTR_TYPE_EL3);
+
+	gicv3_raise_sgi_multi((unsigned int)sgi_num, GICV3_G0, targets,
+			      num_targets);
+}
+
 void plat_ic_raise_ns_sgi(int sgi_num, u_register_t target)
 {
 	/* Target must be a valid MPIDR in the system */
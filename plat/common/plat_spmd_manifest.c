@@ -78,12 +78,19 @@ static int manifest_parse_attribute(spmc_manifest_attribute_t *attr,
 			"Entry point");
 	}
 
+	rc = fdt_read_uint32(fdt, node, "el1_ctx_preserved",
+			     &attr->el1_ctx_preserved);
+	if (rc != 0) {
+		attr->el1_ctx_preserved = 0U;
+	}
+
 	VERBOSE("SPM Core manifest attribute section:\n");
 	VERBOSE("  version: %u.%u\n", attr->major_version, attr->minor_version);
 	VERBOSE("  spmc_id: 0x%x\n", attr->spmc_id);
 	VERBOSE("  binary_size: 0x%x\n", attr->binary_size);
 	VERBOSE("  load_address: 0x%" PRIx64 "\n", attr->load_address);
 	VERBOSE("  entrypoint: 0x%" PRIx64 "\n", attr->entrypoint);
+	VERBOSE("  el1_ctx_preserved: %u\n", attr->el1_ctx_preserved);
 
 	return 0;
 }
@@ -56,7 +56,7 @@ static void context_save(unsigned long security_state)
 
 	cm_el1_sysregs_context_save((uint32_t) security_state);
 #if CTX_INCLUDE_FPREGS
-	fpregs_context_save(get_fpregs_ctx(cm_get_context(security_state)));
+	cm_fpregs_context_save((uint32_t) security_state);
 #endif
 }
 
@@ -73,7 +73,7 @@ static void *context_restore(unsigned long security_state)
 	/* Restore state */
 	cm_el1_sysregs_context_restore((uint32_t) security_state);
 #if CTX_INCLUDE_FPREGS
-	fpregs_context_restore(get_fpregs_ctx(cm_get_context(security_state)));
+	cm_fpregs_context_restore((uint32_t) security_state);
 #endif
 
 	cm_set_next_eret_context((uint32_t) security_state);
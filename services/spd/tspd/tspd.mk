@@ -44,3 +44,17 @@ endif
 
 $(eval $(call assert_boolean,TSP_NS_INTR_ASYNC_PREEMPT))
 $(eval $(call add_define,TSP_NS_INTR_ASYNC_PREEMPT))
+
+# Flag used to enable the SMC round trip latency benchmark mode in the TSP and
+# the TSPD.
+TSP_BENCHMARK			:=	0
+
+ifeq ($(TSP_BENCHMARK),1)
+ifneq ($(ENABLE_PMF),1)
+$(error TSP_BENCHMARK requires ENABLE_PMF=1)
+endif
+SPD_SOURCES		+=	services/spd/tspd/tspd_bench.c
+endif
+
+$(eval $(call assert_boolean,TSP_BENCHMARK))
+$(eval $(call add_define,TSP_BENCHMARK))
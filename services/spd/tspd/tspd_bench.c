@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*******************************************************************************
+ * Round trip latency statistics gathered by the TSPD when built with
+ * TSP_BENCHMARK=1. Each round trip is timed in EL3 from the point the TSPD
+ * receives the request (or the S-EL1 interrupt) to the point it returns to the
+ * Normal world, and accumulated in per-CPU log-linear histograms from which
+ * percentiles are computed on request.
+ ******************************************************************************/
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <bl32/tsp/tsp.h>
+#include <common/runtime_svc.h>
+#include <lib/pmf/pmf.h>
+#include <plat/common/platform.h>
+
+#include "tspd_private.h"
+
+PMF_REGISTER_SERVICE_SMC(tsp_bench_svc, PMF_TSP_BENCH_SVC_ID,
+	TSP_BENCH_TOTAL_IDS, PMF_STORE_ENABLE)
+
+/*
+ * Histogram layout: values below 2^TSPD_BENCH_SUB_BITS ticks get a bucket
+ * each, then every power of two is split into 2^TSPD_BENCH_SUB_BITS buckets,
+ * up to 2^TSPD_BENCH_MAX_LOG2 ticks. Larger values go to the last bucket. The
+ * width of a bucket is at most 1/8 of its lower bound.
+ */
+#define TSPD_BENCH_SUB_BITS	U(3)
+#define TSPD_BENCH_SUB_MASK	((U(1) << TSPD_BENCH_SUB_BITS) - U(1))
+#define TSPD_BENCH_MAX_LOG2	U(20)
+#define TSPD_BENCH_BUCKETS	((TSPD_BENCH_MAX_LOG2 - TSPD_BENCH_SUB_BITS + U(2)) \
+					<< TSPD_BENCH_SUB_BITS)
+
+typedef struct tspd_bench_stats {
+	uint64_t count;
+	uint64_t total;
+	uint64_t min;
+	uint64_t max;
+	uint32_t hist[TSPD_BENCH_BUCKETS];
+} tspd_bench_stats_t;
+
+/* Only written by the owning CPU, so no locking is needed on the SMC path */
+static tspd_bench_stats_t tspd_bench_stats[TSPD_CORE_COUNT][TSP_BENCH_CATEGORIES];
+
+static unsigned int tspd_bench_bucket(uint64_t ticks)
+{
+	unsigned int msb;
+	unsigned int idx;
+
+	if (ticks <= TSPD_BENCH_SUB_MASK) {
+		return (unsigned int)ticks;
+	}
+
+	msb = 63U - (unsigned int)__builtin_clzll(ticks);
+	idx = ((msb - TSPD_BENCH_SUB_BITS + 1U) << TSPD_BENCH_SUB_BITS) |
+	      (unsigned int)((ticks >> (msb - TSPD_BENCH_SUB_BITS)) &
+			     TSPD_BENCH_SUB_MASK);
+
+	return (idx < TSPD_BENCH_BUCKETS) ? idx : (TSPD_BENCH_BUCKETS - 1U);
+}
+
+/* Largest value that falls into bucket 'idx' */
+static uint64_t tspd_bench_bucket_limit(unsigned int idx)
+{
+	unsigned int shift;
+	uint64_t base;
+
+	if (idx <= TSPD_BENCH_SUB_MASK) {
+		return idx;
+	}
+
+	shift = (idx >> TSPD_BENCH_SUB_BITS) - 1U;
+	base = (uint64_t)((idx & TSPD_BENCH_SUB_MASK) |
+			  (U(1) << TSPD_BENCH_SUB_BITS)) << shift;
+
+	return base + (ULL(1) << shift) - 1ULL;
+}
+
+static void tspd_bench_record(unsigned int category, uint64_t start,
+			      uint64_t end)
+{
+	tspd_bench_stats_t *stats;
+	uint64_t ticks = end - start;
+
+	assert(category < TSP_BENCH_CATEGORIES);
+	stats = &tspd_bench_stats[plat_my_core_pos()][category];
+
+	if ((stats->count == 0ULL) || (ticks < stats->min)) {
+		stats->min = ticks;
+	}
+	if (ticks > stats->max) {
+		stats->max = ticks;
+	}
+	stats->count++;
+	stats->total += ticks;
+	stats->hist[tspd_bench_bucket(ticks)]++;
+}
+
+/*******************************************************************************
+ * Start timing a TSP_BENCH request, or the resumption of one, on this CPU.
+ * Fast requests are timed separately, as they can be issued while a yielding
+ * request is preempted.
+ ******************************************************************************/
+void tspd_bench_start(tsp_context_t *tsp_ctx, unsigned int category)
+{
+	uint64_t ts;
+
+	PMF_CAPTURE_AND_GET_TIMESTAMP(tsp_bench_svc, TSP_BENCH_ENTER_EL3,
+				      PMF_NO_CACHE_MAINT, ts);
+
+	if (category == TSP_BENCH_FAST) {
+		tsp_ctx->bench_fast_start = ts;
+	} else {
+		tsp_ctx->bench_start = ts;
+		tsp_ctx->bench_category = category;
+	}
+}
+
+/*******************************************************************************
+ * Complete the fast or yielding TSP_BENCH request timed on this CPU.
+ * 'sp_entry' and 'sp_exit' are the counter values reported by the TSP on entry
+ * and exit.
+ ******************************************************************************/
+void tspd_bench_done(tsp_context_t *tsp_ctx, bool fast, uint64_t sp_entry,
+		     uint64_t sp_exit)
+{
+	uint64_t ts;
+
+	PMF_WRITE_TIMESTAMP(tsp_bench_svc, TSP_BENCH_ENTER_SEL1,
+			    PMF_NO_CACHE_MAINT, sp_entry);
+	PMF_WRITE_TIMESTAMP(tsp_bench_svc, TSP_BENCH_EXIT_SEL1,
+			    PMF_NO_CACHE_MAINT, sp_exit);
+	PMF_CAPTURE_AND_GET_TIMESTAMP(tsp_bench_svc, TSP_BENCH_EXIT_EL3,
+				      PMF_NO_CACHE_MAINT, ts);
+
+	if (fast) {
+		tspd_bench_record(TSP_BENCH_FAST, tsp_ctx->bench_fast_start, ts);
+		return;
+	}
+
+	if (tsp_ctx->bench_category < TSP_BENCH_CATEGORIES) {
+		tspd_bench_record(tsp_ctx->bench_category,
+				  tsp_ctx->bench_start, ts);
+	}
+	tsp_ctx->bench_category = TSPD_BENCH_IDLE;
+}
+
+/*******************************************************************************
+ * Account for the preemption of the yielding TSP_BENCH request timed on this
+ * CPU, if any. Its resumption is timed separately.
+ ******************************************************************************/
+void tspd_bench_preempted(tsp_context_t *tsp_ctx)
+{
+	if ((tsp_ctx->bench_category != TSP_BENCH_YIELD) &&
+	    (tsp_ctx->bench_category != TSP_BENCH_RESUME)) {
+		return;
+	}
+
+	tspd_bench_record(TSP_BENCH_PREEMPT, tsp_ctx->bench_start,
+			  read_cntpct_el0());
+	tsp_ctx->bench_category = TSPD_BENCH_PREEMPTED;
+}
+
+/*******************************************************************************
+ * Start and stop timing an S-EL1 interrupt taken from the Normal world.
+ ******************************************************************************/
+void tspd_bench_intr_start(tsp_context_t *tsp_ctx)
+{
+	tsp_ctx->bench_intr_start = read_cntpct_el0();
+}
+
+void tspd_bench_intr_done(tsp_context_t *tsp_ctx)
+{
+	if (tsp_ctx->bench_intr_start == 0ULL) {
+		return;
+	}
+
+	tspd_bench_record(TSP_BENCH_SEL1_INTR, tsp_ctx->bench_intr_start,
+			  read_cntpct_el0());
+	tsp_ctx->bench_intr_start = 0ULL;
+}
+
+/*******************************************************************************
+ * Handler for TSP_FID_BENCH_GET and TSP_FID_BENCH_RESET.
+ *
+ * TSP_FID_BENCH_GET takes a category in x1 and a percentile from 0 to 100 in
+ * x2. It returns, aggregated over all CPUs, the number of samples in x1, the
+ * minimum and maximum in x2 and x3, an upper bound of the requested
+ * percentile in x4 and the sum of all samples in x5, in counter ticks.
+ *
+ * The statistics of other CPUs are read without synchronisation, so they
+ * should be queried once the benchmark has finished.
+ ******************************************************************************/
+uintptr_t tspd_bench_smc_handler(uint32_t smc_fid, u_register_t x1,
+				 u_register_t x2, void *handle)
+{
+	const tspd_bench_stats_t *stats;
+	uint64_t count = 0ULL, total = 0ULL, min = UINT64_MAX, max = 0ULL;
+	uint64_t target, seen, pct;
+	unsigned int cpu, idx;
+
+	if (smc_fid == TSP_FID_BENCH_RESET) {
+		(void)memset(tspd_bench_stats, 0, sizeof(tspd_bench_stats));
+		SMC_RET1(handle, SMC_OK);
+	}
+
+	if ((x1 >= TSP_BENCH_CATEGORIES) || (x2 > 100U)) {
+		SMC_RET1(handle, SMC_ARCH_CALL_INVAL_PARAM);
+	}
+
+	for (cpu = 0U; cpu < TSPD_CORE_COUNT; cpu++) {
+		stats = &tspd_bench_stats[cpu][x1];
+		if (stats->count == 0ULL) {
+			continue;
+		}
+		count += stats->count;
+		total += stats->total;
+		min = (stats->min < min) ? stats->min : min;
+		max = (stats->max > max) ? stats->max : max;
+	}
+
+	if (count == 0ULL) {
+		SMC_RET6(handle, SMC_OK, 0, 0, 0, 0, 0);
+	}
+
+	/* Smallest bucket under which at least x2 percent of samples lie */
+	target = ((count * x2) + 99ULL) / 100ULL;
+	pct = max;
+	seen = 0ULL;
+	for (idx = 0U; (target != 0ULL) && (idx < TSPD_BENCH_BUCKETS); idx++) {
+		for (cpu = 0U; cpu < TSPD_CORE_COUNT; cpu++) {
+			seen += tspd_bench_stats[cpu][x1].hist[idx];
+		}
+		if (seen >= target) {
+			pct = tspd_bench_bucket_limit(idx);
+			break;
+		}
+	}
+
+	/* Clamp to the observed range */
+	if (target == 0ULL) {
+		pct = min;
+	} else if (pct > max) {
+		pct = max;
+	} else if (pct < min) {
+		pct = min;
+	}
+
+	SMC_RET6(handle, SMC_OK, count, min, max, pct, total);
+}
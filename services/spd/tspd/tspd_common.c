@@ -42,6 +42,10 @@ void tspd_init_tsp_ep_state(struct entry_point_info *tsp_entry_point,
 	/* Associate this context with the cpu specified */
 	tsp_ctx->mpidr = read_mpidr_el1();
 	tsp_ctx->state = 0;
+#if TSP_BENCHMARK
+	tsp_ctx->bench_category = TSPD_BENCH_IDLE;
+	tsp_ctx->bench_intr_start = 0ULL;
+#endif
 	set_tsp_pstate(tsp_ctx->state, TSP_PSTATE_OFF);
 	clr_yield_smc_active_flag(tsp_ctx->state);
 
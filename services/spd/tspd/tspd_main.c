@@ -62,6 +62,9 @@ uint64_t tspd_handle_sp_preemption(void *handle)
 	cpu_context_t *ns_cpu_context;
 
 	assert(handle == cm_get_context(SECURE));
+#if TSP_BENCHMARK
+	tspd_bench_preempted(&tspd_sp_context[plat_my_core_pos()]);
+#endif
 	cm_el1_sysregs_context_save(SECURE);
 	/* Get a reference to the non-secure context */
 	ns_cpu_context = cm_get_context(NON_SECURE);
@@ -153,6 +156,10 @@ static uint64_t tspd_sel1_interrupt_handler(uint32_t id,
 		/* Sanity check the pointer to this cpu's context */
 		assert(handle == cm_get_context(NON_SECURE));
 
+#if TSP_BENCHMARK
+		tspd_bench_intr_start(tsp_ctx);
+#endif
+
 		/* Save the non-secure context before entering the TSP */
 		cm_el1_sysregs_context_save(NON_SECURE);
 		tsp_ctx->preempted_by_sel1_intr = false;
@@ -173,6 +180,10 @@ static uint64_t tspd_sel1_interrupt_handler(uint32_t id,
 	/* Sanity check the pointer to this cpu's context */
 	assert(handle == cm_get_context(NON_SECURE));
 
+#if TSP_BENCHMARK
+	tspd_bench_intr_start(tsp_ctx);
+#endif
+
 	/* Save the non-secure context before entering the TSP */
 	cm_el1_sysregs_context_save(NON_SECURE);
 #endif
@@ -416,11 +427,18 @@ static uintptr_t tspd_smc_handler(uint32_t smc_fid,
 		cm_el1_sysregs_context_restore(NON_SECURE);
 		cm_set_next_eret_context(NON_SECURE);
 
+#if TSP_BENCHMARK
+		tspd_bench_intr_done(tsp_ctx);
+#endif
+
 		/* Refer to Note 1 in function tspd_sel1_interrupt_handler()*/
 #if TSP_NS_INTR_ASYNC_PREEMPT
 		if (tsp_ctx->preempted_by_sel1_intr) {
 			/* Reset the flag */
 			tsp_ctx->preempted_by_sel1_intr = false;
+#if TSP_BENCHMARK
+			tspd_bench_preempted(tsp_ctx);
+#endif
 
 			SMC_RET1(ns_cpu_context, SMC_PREEMPTED);
 		} else {
@@ -575,6 +593,11 @@ static uintptr_t tspd_smc_handler(uint32_t smc_fid,
 		 * of the DIT PSTATE bit.
 		 */
 	case TSP_YIELD_FID(TSP_CHECK_DIT):
+#if TSP_BENCHMARK
+		/* Requests used to measure the SMC round trip latency */
+	case TSP_FAST_FID(TSP_BENCH):
+	case TSP_YIELD_FID(TSP_BENCH):
+#endif
 		if (ns) {
 			/*
 			 * This is a fresh request from the non-secure client.
@@ -588,6 +611,14 @@ static uintptr_t tspd_smc_handler(uint32_t smc_fid,
 			if (get_yield_smc_active_flag(tsp_ctx->state))
 				SMC_RET1(handle, SMC_UNK);
 
+#if TSP_BENCHMARK
+			if (TSP_BARE_FID(smc_fid) == TSP_BENCH) {
+				tspd_bench_start(tsp_ctx,
+					(GET_SMC_TYPE(smc_fid) == SMC_TYPE_FAST) ?
+					TSP_BENCH_FAST : TSP_BENCH_YIELD);
+			}
+#endif
+
 			cm_el1_sysregs_context_save(NON_SECURE);
 
 			/* Save x1 and x2 for use by TSP_GET_ARGS call below */
@@ -673,6 +704,15 @@ static uintptr_t tspd_smc_handler(uint32_t smc_fid,
 #endif
 			}
 
+#if TSP_BENCHMARK
+			/* The TSP returns its entry and exit times in x2-x3 */
+			if (TSP_BARE_FID(smc_fid) == TSP_BENCH) {
+				tspd_bench_done(tsp_ctx,
+					GET_SMC_TYPE(smc_fid) == SMC_TYPE_FAST,
+					x2, x3);
+			}
+#endif
+
 			SMC_RET3(ns_cpu_context, x1, x2, x3);
 		}
 		assert(0); /* Unreachable */
@@ -731,6 +771,12 @@ static uintptr_t tspd_smc_handler(uint32_t smc_fid,
 		if (!get_yield_smc_active_flag(tsp_ctx->state))
 			SMC_RET1(handle, SMC_UNK);
 
+#if TSP_BENCHMARK
+		if (tsp_ctx->bench_category == TSPD_BENCH_PREEMPTED) {
+			tspd_bench_start(tsp_ctx, TSP_BENCH_RESUME);
+		}
+#endif
+
 		cm_el1_sysregs_context_save(NON_SECURE);
 
 		/*
@@ -774,6 +820,19 @@ static uintptr_t tspd_smc_handler(uint32_t smc_fid,
 		get_tsp_args(tsp_ctx, x1, x2);
 		SMC_RET2(handle, x1, x2);
 
+#if TSP_BENCHMARK
+		/*
+		 * Request from the non-secure world to read or clear the round
+		 * trip latency statistics.
+		 */
+	case TSP_FID_BENCH_GET:
+	case TSP_FID_BENCH_RESET:
+		if (!ns)
+			SMC_RET1(handle, SMC_UNK);
+
+		return tspd_bench_smc_handler(smc_fid, x1, x2, handle);
+#endif
+
 	case TOS_CALL_COUNT:
 		/*
 		 * Return the number of service function IDs implemented to
@@ -177,6 +177,15 @@ CASSERT(TSPD_SP_CTX_SIZE == sizeof(sp_ctx_regs_t),
  *                    register context after it has been preempted by an EL3
  *                    routed NS interrupt and when a Secure Interrupt is taken
  *                    to SP.
+ * 'bench_start'    - counter value when the yielding TSP_BENCH request, or
+ *                    its resumption, being timed was received.
+ * 'bench_fast_start' - counter value when the fast TSP_BENCH request being
+ *                    timed was received. Kept apart from 'bench_start' so that
+ *                    fast requests do not disturb a preempted yielding one.
+ * 'bench_intr_start' - counter value when the S-EL1 interrupt being timed was
+ *                    taken, or 0.
+ * 'bench_category' - TSP_BENCH_* category of the yielding request being timed,
+ *                    or one of the TSPD_BENCH_* states.
  ******************************************************************************/
 typedef struct tsp_context {
 	uint64_t saved_elr_el3;
@@ -190,8 +199,21 @@ typedef struct tsp_context {
 	sp_ctx_regs_t sp_ctx;
 	bool preempted_by_sel1_intr;
 #endif
+#if TSP_BENCHMARK
+	uint64_t bench_start;
+	uint64_t bench_fast_start;
+	uint64_t bench_intr_start;
+	uint32_t bench_category;
+#endif
 } tsp_context_t;
 
+#if TSP_BENCHMARK
+/* No yielding TSP_BENCH request is being timed */
+#define TSPD_BENCH_IDLE		U(0xff)
+/* A yielding TSP_BENCH request was preempted and can be resumed */
+#define TSPD_BENCH_PREEMPTED	U(0xfe)
+#endif
+
 /* Helper macros to store and retrieve tsp args from tsp_context */
 #define store_tsp_args(_tsp_ctx, _x1, _x2)		do {\
 				_tsp_ctx->saved_tsp_args[0] = _x1;\
@@ -226,6 +248,17 @@ int tspd_abort_preempted_smc(tsp_context_t *tsp_ctx);
 
 uint64_t tspd_handle_sp_preemption(void *handle);
 
+#if TSP_BENCHMARK
+void tspd_bench_start(tsp_context_t *tsp_ctx, unsigned int category);
+void tspd_bench_done(tsp_context_t *tsp_ctx, bool fast, uint64_t sp_entry,
+		     uint64_t sp_exit);
+void tspd_bench_preempted(tsp_context_t *tsp_ctx);
+void tspd_bench_intr_start(tsp_context_t *tsp_ctx);
+void tspd_bench_intr_done(tsp_context_t *tsp_ctx);
+uintptr_t tspd_bench_smc_handler(uint32_t smc_fid, u_register_t x1,
+				 u_register_t x2, void *handle);
+#endif
+
 extern tsp_context_t tspd_sp_context[TSPD_CORE_COUNT];
 extern tsp_vectors_t *tsp_vectors;
 #endif /*__ASSEMBLER__*/
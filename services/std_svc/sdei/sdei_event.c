@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -51,6 +51,74 @@ sdei_entry_t *get_event_entry(sdei_ev_map_t *map)
 	}
 }
 
+/*
+ * Interrupt number to event mapping lookup table. Each entry holds the index of
+ * the map bound to the interrupt in its mapping plus one, or 0 if no event is
+ * bound to it. As private events are bound to SGIs and PPIs, and shared events
+ * to SPIs, the interrupt number also determines which mapping the index refers
+ * to.
+ */
+static uint16_t sdei_intr_map_idx[PLAT_SDEI_INTR_LOOKUP_SIZE];
+
+static bool sdei_intr_lookup_valid(unsigned int intr_num)
+{
+	/* SDEI_DYN_IRQ also marks free dynamic maps, so always scan for it */
+	return (intr_num != SDEI_DYN_IRQ) &&
+		(intr_num < PLAT_SDEI_INTR_LOOKUP_SIZE);
+}
+
+/* Lookup table entry for a map */
+static uint16_t sdei_intr_lookup_entry(sdei_ev_map_t *map)
+{
+	const sdei_mapping_t *mapping;
+
+	mapping = is_event_private(map) ? SDEI_PRIVATE_MAPPING() :
+		SDEI_SHARED_MAPPING();
+
+	return (uint16_t) (MAP_OFF(map, mapping) + 1);
+}
+
+/*
+ * Record that a map is bound to its interrupt. If several maps are bound to
+ * the same interrupt, the first one is kept, as a linear search would find.
+ */
+void sdei_intr_lookup_set(sdei_ev_map_t *map)
+{
+	if (sdei_intr_lookup_valid(map->intr) &&
+			(sdei_intr_map_idx[map->intr] == 0U))
+		sdei_intr_map_idx[map->intr] = sdei_intr_lookup_entry(map);
+}
+
+/* Record that a map is about to be released from its interrupt */
+void sdei_intr_lookup_clear(sdei_ev_map_t *map)
+{
+	if (sdei_intr_lookup_valid(map->intr) &&
+			(sdei_intr_map_idx[map->intr] ==
+			 sdei_intr_lookup_entry(map)))
+		sdei_intr_map_idx[map->intr] = 0U;
+}
+
+/*
+ * Populate the lookup table with the interrupts of statically bound events and
+ * of event 0. Must be called once the mappings have been initialised.
+ */
+void sdei_intr_lookup_init(void)
+{
+	const sdei_mapping_t *mapping;
+	sdei_ev_map_t *map;
+	unsigned int i, j;
+
+	for_each_mapping_type(i, mapping) {
+		/* The table can only hold UINT16_MAX - 1 map indices */
+		assert(mapping->num_maps < UINT16_MAX);
+
+		iterate_mapping(mapping, j, map) {
+			if ((map->ev_num == SDEI_EVENT_0) || is_map_bound(map))
+				sdei_intr_lookup_set(map);
+		}
+	}
+}
+
 /*
  * Find event mapping for a given interrupt number: On success, returns pointer
  * to the event mapping. On error, returns NULL.
@@ -61,12 +129,22 @@ sdei_ev_map_t *find_event_map_by_intr(unsigned int intr_num, bool shared)
 	sdei_ev_map_t *map;
 	unsigned int i;
 
+	mapping = shared ? SDEI_SHARED_MAPPING() : SDEI_PRIVATE_MAPPING();
+
 	/*
-	 * Look for a match in private and shared mappings, as requested. This
-	 * is a linear search. However, if the mappings are required to be
-	 * sorted, for large maps, we could consider binary search.
+	 * Interrupts covered by the lookup table are found directly. The map
+	 * it points to is checked, so that a stale entry can never be returned.
 	 */
-	mapping = shared ? SDEI_SHARED_MAPPING() : SDEI_PRIVATE_MAPPING();
+	if (sdei_intr_lookup_valid(intr_num)) {
+		i = sdei_intr_map_idx[intr_num];
+		if ((i == 0U) || (i > mapping->num_maps))
+			return NULL;
+
+		map = &mapping->map[i - 1U];
+		return (map->intr == intr_num) ? map : NULL;
+	}
+
+	/* Look for a match in private and shared mappings, as requested */
 	iterate_mapping(mapping, i, map) {
 		if (map->intr == intr_num)
 			return map;
@@ -83,17 +161,26 @@ sdei_ev_map_t *find_event_map(int ev_num)
 {
 	const sdei_mapping_t *mapping;
 	sdei_ev_map_t *map;
-	unsigned int i, j;
+	unsigned int i;
+	size_t lo, hi, mid;
 
 	/*
-	 * Iterate through mappings to find a match. This is a linear search.
-	 * However, if the mappings are required to be sorted, for large maps,
-	 * we could consider binary search.
+	 * Mappings are required to be sorted in the increasing order of event
+	 * number, so each of them can be binary searched.
 	 */
 	for_each_mapping_type(i, mapping) {
-		iterate_mapping(mapping, j, map) {
+		lo = 0U;
+		hi = mapping->num_maps;
+		while (lo < hi) {
+			mid = lo + ((hi - lo) / 2U);
+			map = &mapping->map[mid];
 			if (map->ev_num == ev_num)
 				return map;
+
+			if (map->ev_num < ev_num)
+				lo = mid + 1U;
+			else
+				hi = mid;
 		}
 	}
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -17,6 +17,9 @@
 #include <common/debug.h>
 #include <common/runtime_svc.h>
 #include <lib/cassert.h>
+#include <lib/el3_runtime/cpu_data.h>
+#include <lib/pmf/pmf.h>
+#include <lib/runtime_instr.h>
 #include <services/sdei.h>
 
 #include "sdei_private.h"
@@ -57,6 +60,21 @@ typedef struct sdei_cpu_state {
 /* SDEI states for all cores in the system */
 static sdei_cpu_state_t cpu_state[PLATFORM_CORE_COUNT];
 
+/*
+ * Features affecting the SPSR of the handler, which are probed once at init
+ * rather than on every dispatch.
+ */
+static bool sdei_feat_vhe, sdei_feat_pan, sdei_feat_ssbs, sdei_feat_mte;
+
+void sdei_dispatch_init(void)
+{
+	sdei_feat_vhe = (read_feat_vhe_id_field() != 0U);
+	sdei_feat_pan = is_feat_pan_supported();
+	sdei_feat_ssbs = (((read_id_aa64pfr1_el1() >> ID_AA64PFR1_EL1_SSBS_SHIFT)
+				& ID_AA64PFR1_EL1_SSBS_MASK) != SSBS_UNAVAILABLE);
+	sdei_feat_mte = (get_armv8_5_mte_support() >= MTE_IMPLEMENTED_ELX);
+}
+
 int64_t sdei_pe_mask(void)
 {
 	int64_t ret = 0;
@@ -269,12 +287,12 @@ static void sdei_set_elr_spsr(sdei_entry_t *se, sdei_dispatch_context_t *disp_ct
 	 * bit in SCTLR_EL2 as we have already checked for the condition
 	 * HCR_EL2.E2H = 1 and HCR_EL2.TGE = 1
 	 */
-	u_register_t hcr_el2 = read_hcr();
-	bool el_is_in_host = (read_feat_vhe_id_field() != 0U) &&
+	u_register_t hcr_el2 = sdei_feat_vhe ? read_hcr() : 0U;
+	bool el_is_in_host = sdei_feat_vhe &&
 			     (hcr_el2 & HCR_TGE_BIT) &&
 			     (hcr_el2 & HCR_E2H_BIT);
 
-	if (is_feat_pan_supported() &&
+	if (sdei_feat_pan &&
 	    ((client_el == MODE_EL1) ||
 		(client_el == MODE_EL2 && el_is_in_host)) &&
 	    ((client_el_sctlr & SCTLR_SPAN_BIT) == 0U)) {
@@ -284,10 +302,7 @@ static void sdei_set_elr_spsr(sdei_entry_t *se, sdei_dispatch_context_t *disp_ct
 	}
 
 	/* If SSBS is implemented, take the value from the client el SCTLR */
-	u_register_t ssbs_enabled = (read_id_aa64pfr1_el1()
-					>> ID_AA64PFR1_EL1_SSBS_SHIFT)
-					& ID_AA64PFR1_EL1_SSBS_MASK;
-	if (ssbs_enabled != SSBS_UNAVAILABLE) {
+	if (sdei_feat_ssbs) {
 		u_register_t  ssbs_bit = ((client_el_sctlr & SCTLR_DSSBS_BIT)
 						>> SCTLR_DSSBS_SHIFT)
 						<< SPSR_SSBS_SHIFT_AARCH64;
@@ -295,7 +310,7 @@ static void sdei_set_elr_spsr(sdei_entry_t *se, sdei_dispatch_context_t *disp_ct
 	}
 
 	/* If MTE is implemented in the client el set the TCO bit */
-	if (get_armv8_5_mte_support() >= MTE_IMPLEMENTED_ELX) {
+	if (sdei_feat_mte) {
 		sdei_spsr |= SPSR_TCO_BIT_AARCH64;
 	}
 
@@ -417,6 +432,12 @@ int sdei_intr_handler(uint32_t intr_raw, uint32_t flags, void *handle,
 	jmp_buf dispatch_jmp;
 	const uint64_t mpidr = read_mpidr_el1();
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_ENTER_SDEI_DISPATCH,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
 	/*
 	 * To handle an event, the following conditions must be true:
 	 *
@@ -549,6 +570,13 @@ int sdei_intr_handler(uint32_t intr_raw, uint32_t flags, void *handle,
 
 	/* Synchronously dispatch event */
 	setup_ns_dispatch(map, se, ctx, &dispatch_jmp);
+
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_EXIT_SDEI_DISPATCH,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
 	begin_sdei_synchronous_dispatch(&dispatch_jmp);
 
 	/*
@@ -575,6 +603,12 @@ int sdei_intr_handler(uint32_t intr_raw, uint32_t flags, void *handle,
 	}
 	plat_ic_end_of_interrupt(intr_raw);
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_EXIT_SDEI_COMPLETE,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
 	return 0;
 }
 
@@ -702,6 +736,14 @@ int sdei_event_complete(bool resume, uint64_t pc)
 	if (is_event_shared(map))
 		sdei_map_unlock(map);
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	/* The entry timestamp was captured on entry to EL3 for this SMC */
+	PMF_WRITE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_ENTER_SDEI_COMPLETE,
+	    PMF_NO_CACHE_MAINT,
+	    get_cpu_data(cpu_data_pmf_ts[CPU_DATA_PMF_TS0_IDX]));
+#endif
+
 	/* Having done sanity checks, pop dispatch */
 	(void) pop_dispatch();
 
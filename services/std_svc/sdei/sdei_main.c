@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -231,6 +231,8 @@ void sdei_init(void)
 	plat_sdei_setup();
 	sdei_class_init(SDEI_CRITICAL);
 	sdei_class_init(SDEI_NORMAL);
+	sdei_intr_lookup_init();
+	sdei_dispatch_init();
 
 	/* Register priority level handlers */
 	ehf_register_priority_handler(PLAT_SDEI_CRITICAL_PRI,
@@ -766,6 +768,7 @@ static int sdei_interrupt_bind(unsigned int intr_num)
 		if (!is_map_bound(map)) {
 			map->intr = intr_num;
 			set_map_bound(map);
+			sdei_intr_lookup_set(map);
 			retry = false;
 		}
 		sdei_map_unlock(map);
@@ -823,6 +826,7 @@ static int sdei_interrupt_release(int ev_num)
 		 * during unregister.
 		 */
 
+		sdei_intr_lookup_clear(map);
 		map->intr = SDEI_DYN_IRQ;
 		clr_map_bound(map);
 	} else {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -34,6 +34,15 @@
 # error Platform must define SDEI normal priority value
 #endif
 
+/*
+ * Number of interrupt IDs, starting from 0, whose event mapping is looked up
+ * through a table rather than by searching the mappings. The default covers
+ * all SGIs, PPIs and SPIs.
+ */
+#ifndef PLAT_SDEI_INTR_LOOKUP_SIZE
+# define PLAT_SDEI_INTR_LOOKUP_SIZE	1020U
+#endif
+
 /* Output SDEI logs as verbose */
 #define SDEI_LOG(...)	VERBOSE("SDEI: " __VA_ARGS__)
 
@@ -230,6 +239,9 @@ extern sdei_entry_t sdei_shared_event_table[];
 
 void init_sdei_state(void);
 
+void sdei_intr_lookup_init(void);
+void sdei_intr_lookup_set(sdei_ev_map_t *map);
+void sdei_intr_lookup_clear(sdei_ev_map_t *map);
 sdei_ev_map_t *find_event_map_by_intr(unsigned int intr_num, bool shared);
 sdei_ev_map_t *find_event_map(int ev_num);
 sdei_entry_t *get_event_entry(sdei_ev_map_t *map);
@@ -240,6 +252,7 @@ int sdei_event_complete(bool resume, uint64_t pc);
 void sdei_pe_unmask(void);
 int64_t sdei_pe_mask(void);
 
+void sdei_dispatch_init(void);
 int sdei_intr_handler(uint32_t intr_raw, uint32_t flags, void *handle,
 		void *cookie);
 bool can_sdei_state_trans(sdei_entry_t *se, sdei_action_t act);
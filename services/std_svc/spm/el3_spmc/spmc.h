@@ -40,6 +40,10 @@
 #define FFA_FEATURES_BIT31_MASK		U(0x1u << 31)
 #define FFA_FEATURES_RET_REQ_NS_BIT	U(0x1 << 1)
 
+/* FF-A feature IDs. */
+#define FFA_FEATURE_NPI			U(0x1)
+#define FFA_FEATURE_SRI			U(0x2)
+
 #define FFA_RUN_EP_ID(ep_vcpu_ids) \
 		((ep_vcpu_ids >> FFA_PARTITION_ID_SHIFT) & FFA_ID_MASK)
 #define FFA_RUN_VCPU_ID(ep_vcpu_ids) \
@@ -110,8 +114,112 @@ struct mailbox {
 
 	/* Lock access to mailbox. */
 	spinlock_t lock;
+
+	/* The RX buffer holds an indirect message delivered by the SPMC. */
+	bool indirect_msg;
+};
+
+/*
+ * Header of an indirect message sent with FFA_MSG_SEND2, as per the FF-A v1.1
+ * specification. The payload starts at 'offset' bytes from the start of the
+ * header.
+ */
+struct ffa_partition_rxtx_header {
+	uint32_t flags;
+	uint32_t reserved;
+	uint32_t offset;
+	uint32_t sender_receiver;
+	uint32_t size;
+};
+
+#define FFA_RXTX_HEADER_SENDER_SHIFT	U(16)
+#define FFA_RXTX_HEADER_SENDER(_ids) \
+		(((_ids) >> FFA_RXTX_HEADER_SENDER_SHIFT) & FFA_ID_MASK)
+#define FFA_RXTX_HEADER_RECEIVER(_ids)	((_ids) & FFA_ID_MASK)
+
+/*
+ * Number of indirect messages that can be queued for an SP and maximum size
+ * of a message, header included. Platforms can override both.
+ */
+#ifndef SPMC_MSG_RING_SLOTS
+#define SPMC_MSG_RING_SLOTS	U(8)
+#endif
+#ifndef SPMC_MSG_SLOT_SIZE
+#define SPMC_MSG_SLOT_SIZE	U(512)
+#endif
+
+CASSERT(SPMC_MSG_SLOT_SIZE <= FFA_PAGE_SIZE, assert_spmc_msg_slot_size);
+
+/*
+ * A slot of the indirect message ring. 'size' is written last by the producer
+ * and cleared by the consumer once the message has been delivered.
+ */
+struct spmc_msg_slot {
+	volatile uint32_t size;
+	uint8_t data[SPMC_MSG_SLOT_SIZE];
 };
 
+/*
+ * Ring of indirect messages queued for an SP. Producers reserve a slot by
+ * advancing 'tail' under 'lock' and fill it without holding the lock. Messages
+ * are delivered in order from 'head' by the SPMC, with the mailbox lock of the
+ * receiver held.
+ */
+struct spmc_msg_ring {
+	uint32_t head;
+	uint32_t tail;
+	spinlock_t lock;
+	struct spmc_msg_slot slot[SPMC_MSG_RING_SLOTS];
+};
+
+/*
+ * Notification state of an endpoint, as per the FF-A v1.1 specification.
+ * Bindings only change with 'lock' held. Pending notifications are set with
+ * atomic operations, so a sender never takes the lock.
+ */
+#define FFA_NOTIFICATIONS_COUNT		U(64)
+
+struct spmc_notif_state {
+	/* Sender each notification is bound to. */
+	uint16_t sender[FFA_NOTIFICATIONS_COUNT];
+
+	/* Bound notifications, those bound to an SP and those per-vCPU. */
+	uint64_t bound;
+	uint64_t bound_sp;
+	uint64_t bound_per_vcpu;
+
+	/* Pending global, per-vCPU and SPM framework notifications. */
+	volatile uint64_t pending;
+	volatile uint64_t pending_vcpu[PLATFORM_CORE_COUNT];
+	volatile uint64_t pending_fwk;
+
+	/*
+	 * Pending notifications not yet reported by
+	 * FFA_NOTIFICATION_INFO_GET: bit 0 of 'info_global' for global and
+	 * framework notifications, and one bit per vCPU in 'info_vcpu'.
+	 */
+	volatile uint64_t info_global;
+	volatile uint64_t info_vcpu;
+
+	/* Number of vCPUs of the endpoint. */
+	uint32_t vcpu_count;
+
+	spinlock_t lock;
+};
+
+CASSERT(PLATFORM_CORE_COUNT <= 64U, assert_spmc_notif_vcpu_count);
+
+/* SPM framework notification signalling a queued indirect message. */
+#define FFA_NOTIFICATION_SPM_BUFFER_FULL	BIT(0)
+
+/*
+ * SGI used as the Schedule Receiver Interrupt, signalled to the Normal world
+ * scheduler when a notification is pending. Platforms can override it.
+ */
+#ifndef SPMC_SRI_SGI_ID
+#define SPMC_SRI_SGI_ID		U(8)
+#endif
+
 /*
  * Execution context members for an SP. This is a bit like struct
  * vcpu in a hypervisor.
@@ -165,6 +273,12 @@ struct secure_partition_desc {
 	/* Mailbox tracking. */
 	struct mailbox mailbox;
 
+	/* Indirect messages waiting to be delivered to the RX buffer. */
+	struct spmc_msg_ring msg_ring;
+
+	/* Notifications for which the SP is the receiver. */
+	struct spmc_notif_state notif;
+
 	/* Secondary entrypoint. Only valid for a S-EL1 SP. */
 	uintptr_t secondary_ep;
 
@@ -287,6 +401,16 @@ struct el3_lp_desc *get_el3_lp_array(void);
  */
 struct mailbox *spmc_get_mbox_desc(bool secure_origin);
 
+/*
+ * Helper function to obtain the descriptor of the SP at a given index.
+ */
+struct secure_partition_desc *spmc_get_sp_desc(unsigned int index);
+
+/*
+ * Helper function to obtain the descriptor of the Hypervisor or OS kernel.
+ */
+struct ns_endpoint_desc *spmc_get_hyp_ctx(void);
+
 /*
  * Helper function to obtain the context of an SP with a given partition ID.
  */
@@ -298,5 +422,50 @@ struct secure_partition_desc *spmc_get_sp_ctx(uint16_t id);
  */
 uint32_t get_partition_ffa_version(bool secure_origin);
 
+/*
+ * Handler for FFA_MSG_SEND2, which queues an indirect message for an SP.
+ */
+uint64_t spmc_ffa_msg_send2(uint32_t smc_fid,
+			    bool secure_origin,
+			    uint64_t x1,
+			    uint64_t x2,
+			    uint64_t x3,
+			    uint64_t x4,
+			    void *cookie,
+			    void *handle,
+			    uint64_t flags);
+
+/*
+ * Deliver the oldest indirect message queued for an SP to its RX buffer, if
+ * the buffer is free. Returns true and the sender/receiver IDs and payload size
+ * of the message if one was delivered.
+ */
+bool spmc_msg_deliver(struct secure_partition_desc *sp,
+		      uint32_t *sender_receiver, uint32_t *size);
+
+/*
+ * Handler for the FFA_NOTIFICATION_* ABIs.
+ */
+uint64_t spmc_ffa_notification_handler(uint32_t smc_fid,
+				       bool secure_origin,
+				       uint64_t x1,
+				       uint64_t x2,
+				       uint64_t x3,
+				       uint64_t x4,
+				       void *cookie,
+				       void *handle,
+				       uint64_t flags);
+
+/*
+ * Signal a pending SPM framework notification to an SP.
+ */
+void spmc_notif_fwk_set(struct secure_partition_desc *sp, uint64_t bits);
+
+/*
+ * Raise the Schedule Receiver Interrupt delayed by FFA_NOTIFICATION_SET on this
+ * CPU, if any. Called before returning to the Normal world.
+ */
+void spmc_notif_sri_flush(void);
+
 
 #endif /* SPMC_H */
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <assert.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <common/runtime_svc.h>
+#include <lib/spinlock.h>
+#include <services/ffa_svc.h>
+#include "spmc.h"
+
+#include <platform_def.h>
+
+/*
+ * Obtain the FF-A ID of the caller of FFA_MSG_SEND2. An SP always sends with
+ * its own ID. A Hypervisor sending on behalf of a VM passes the ID of the VM
+ * in w1[31:16], which is validated by the caller.
+ */
+static uint16_t msg_send2_caller_id(bool secure_origin, uint64_t x1)
+{
+	uint16_t vm_id = (uint16_t)((x1 >> FFA_PARTITION_ID_SHIFT) &
+				    FFA_ID_MASK);
+
+	if (secure_origin) {
+		return spmc_get_current_sp_ctx()->sp_id;
+	}
+
+	return (vm_id != 0U) ? vm_id : spmc_get_hyp_ctx()->ns_ep_id;
+}
+
+/*******************************************************************************
+ * Handle FFA_MSG_SEND2. The message in the TX buffer of the caller is copied
+ * to the next free slot of the ring of the receiver. It is delivered to the RX
+ * buffer of the receiver the next time the receiver is run, or as soon as it
+ * waits for messages if it is already running. Only SPs managed by the SPMC
+ * can receive indirect messages.
+ ******************************************************************************/
+uint64_t spmc_ffa_msg_send2(uint32_t smc_fid,
+			    bool secure_origin,
+			    uint64_t x1,
+			    uint64_t x2,
+			    uint64_t x3,
+			    uint64_t x4,
+			    void *cookie,
+			    void *handle,
+			    uint64_t flags)
+{
+	struct mailbox *mbox = spmc_get_mbox_desc(secure_origin);
+	struct ffa_partition_rxtx_header header;
+	struct secure_partition_desc *receiver;
+	struct spmc_msg_ring *ring;
+	struct spmc_msg_slot *slot;
+	uint16_t sender_id;
+	uint16_t receiver_id;
+	uint32_t msg_size;
+	uint32_t buf_size;
+	int ret;
+
+	/* No flags are supported. */
+	if ((uint32_t)x2 != 0U) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	spin_lock(&mbox->lock);
+
+	if (mbox->tx_buffer == NULL) {
+		ret = FFA_ERROR_DENIED;
+		goto err_unlock;
+	}
+
+	/*
+	 * Take a copy of the header so that it cannot be changed by the sender
+	 * after it has been validated.
+	 */
+	(void)memcpy(&header, mbox->tx_buffer, sizeof(header));
+
+	buf_size = mbox->rxtx_page_count * FFA_PAGE_SIZE;
+	if ((header.flags != 0U) || (header.offset < sizeof(header)) ||
+	    (header.offset > SPMC_MSG_SLOT_SIZE) ||
+	    (header.size > (SPMC_MSG_SLOT_SIZE - header.offset))) {
+		VERBOSE("Invalid indirect message (offset 0x%x size 0x%x).\n",
+			header.offset, header.size);
+		ret = FFA_ERROR_INVALID_PARAMETER;
+		goto err_unlock;
+	}
+
+	msg_size = header.offset + header.size;
+	if (msg_size > buf_size) {
+		ret = FFA_ERROR_INVALID_PARAMETER;
+		goto err_unlock;
+	}
+
+	sender_id = FFA_RXTX_HEADER_SENDER(header.sender_receiver);
+	receiver_id = FFA_RXTX_HEADER_RECEIVER(header.sender_receiver);
+	if ((!secure_origin && !ffa_is_normal_world_id(sender_id)) ||
+	    (sender_id != msg_send2_caller_id(secure_origin, x1)) ||
+	    (receiver_id == sender_id)) {
+		VERBOSE("Invalid indirect message sender (0x%x).\n", sender_id);
+		ret = FFA_ERROR_INVALID_PARAMETER;
+		goto err_unlock;
+	}
+
+	receiver = spmc_get_sp_ctx(receiver_id);
+	if (receiver == NULL) {
+		VERBOSE("Indirect message to unknown partition (0x%x).\n",
+			receiver_id);
+		ret = FFA_ERROR_INVALID_PARAMETER;
+		goto err_unlock;
+	}
+
+	/* Reserve a slot in the ring of the receiver. */
+	ring = &receiver->msg_ring;
+	spin_lock(&ring->lock);
+	if ((ring->tail - ring->head) >= SPMC_MSG_RING_SLOTS) {
+		spin_unlock(&ring->lock);
+		ret = FFA_ERROR_BUSY;
+		goto err_unlock;
+	}
+	slot = &ring->slot[ring->tail % SPMC_MSG_RING_SLOTS];
+	ring->tail++;
+	spin_unlock(&ring->lock);
+
+	assert(slot->size == 0U);
+
+	/* Fill the slot, using the validated copy of the header. */
+	(void)memcpy(slot->data, &header, sizeof(header));
+	(void)memcpy(&slot->data[sizeof(header)],
+		     (const uint8_t *)mbox->tx_buffer + sizeof(header),
+		     msg_size - sizeof(header));
+
+	spin_unlock(&mbox->lock);
+
+	/* Publish the message once its content is visible. */
+	dmbish();
+	slot->size = msg_size;
+
+	/* Let the Normal world scheduler know that the receiver has work. */
+	spmc_notif_fwk_set(receiver, FFA_NOTIFICATION_SPM_BUFFER_FULL);
+
+	SMC_RET1(handle, FFA_SUCCESS_SMC32);
+
+err_unlock:
+	spin_unlock(&mbox->lock);
+	return spmc_ffa_error_return(handle, ret);
+}
+
+/*******************************************************************************
+ * Move the oldest indirect message queued for an SP to its RX buffer. Nothing
+ * is delivered if the RX buffer is not mapped or not free, or if the oldest
+ * message is still being written by its sender.
+ ******************************************************************************/
+bool spmc_msg_deliver(struct secure_partition_desc *sp,
+		      uint32_t *sender_receiver, uint32_t *size)
+{
+	struct mailbox *mbox = &sp->mailbox;
+	struct spmc_msg_ring *ring = &sp->msg_ring;
+	const struct ffa_partition_rxtx_header *header;
+	struct spmc_msg_slot *slot;
+	uint32_t msg_size;
+	bool delivered = false;
+
+	spin_lock(&mbox->lock);
+
+	if ((mbox->rx_buffer == NULL) || (mbox->state != MAILBOX_STATE_EMPTY)) {
+		goto out;
+	}
+
+	/*
+	 * 'head' is only updated by a consumer with the mailbox lock of the
+	 * receiver held, so it can be read without taking the ring lock. The
+	 * slot is empty if the ring is.
+	 */
+	slot = &ring->slot[ring->head % SPMC_MSG_RING_SLOTS];
+	msg_size = slot->size;
+	if (msg_size == 0U) {
+		goto out;
+	}
+
+	/* Order the read of the message after the read of its size. */
+	dmbish();
+
+	(void)memcpy(mbox->rx_buffer, slot->data, msg_size);
+	header = (const struct ffa_partition_rxtx_header *)slot->data;
+	*sender_receiver = header->sender_receiver;
+	*size = header->size;
+
+	/* Release the slot before making it available to the producers. */
+	slot->size = 0U;
+	spin_lock(&ring->lock);
+	ring->head++;
+	spin_unlock(&ring->lock);
+
+	mbox->state = MAILBOX_STATE_FULL;
+	mbox->indirect_msg = true;
+	delivered = true;
+
+out:
+	spin_unlock(&mbox->lock);
+	return delivered;
+}
@@ -31,7 +31,7 @@
 #include <platform_def.h>
 
 /* Declare the maximum number of SPs and El3 LPs. */
-#define MAX_SP_LP_PARTITIONS SECURE_PARTITION_COUNT + MAX_EL3_LP_DESCS_COUNT
+#define MAX_SP_LP_PARTITIONS (SECURE_PARTITION_COUNT + MAX_EL3_LP_DESCS_COUNT)
 
 /*
  * Allocate a secure partition descriptor to describe each SP in the system that
@@ -80,6 +80,13 @@ struct sp_exec_ctx *spmc_get_sp_ec(struct secure_partition_desc *sp)
 	return &(sp->ec[get_ec_index(sp)]);
 }
 
+/* Helper function to get pointer to SP context by its index. */
+struct secure_partition_desc *spmc_get_sp_desc(unsigned int index)
+{
+	assert(index < SECURE_PARTITION_COUNT);
+	return &sp_desc[index];
+}
+
 /* Helper function to get pointer to SP context from its ID. */
 struct secure_partition_desc *spmc_get_sp_ctx(uint16_t id)
 {
@@ -209,6 +216,7 @@ static uint64_t spmc_smc_return(uint32_t smc_fid,
 {
 	/* If the destination is in the normal world always go via the SPMD. */
 	if (ffa_is_normal_world_id(dst_id)) {
+		spmc_notif_sri_flush();
 		return spmd_smc_handler(smc_fid, x1, x2, x3, x4,
 					cookie, handle, flags);
 	}
@@ -470,6 +478,29 @@ static uint64_t msg_wait_handler(uint32_t smc_fid,
 		panic();
 	}
 
+	/*
+	 * FFA_MSG_WAIT relinquishes ownership of an RX buffer holding an
+	 * indirect message. If another message is queued for the SP, deliver
+	 * it and resume the SP straight away so that it can process its
+	 * messages in a batch.
+	 */
+	if (sp->ec[idx].rt_model == RT_MODEL_RUN) {
+		uint32_t sender_receiver;
+		uint32_t size;
+
+		spin_lock(&sp->mailbox.lock);
+		if (sp->mailbox.indirect_msg) {
+			sp->mailbox.state = MAILBOX_STATE_EMPTY;
+			sp->mailbox.indirect_msg = false;
+		}
+		spin_unlock(&sp->mailbox.lock);
+
+		if (spmc_msg_deliver(sp, &sender_receiver, &size)) {
+			SMC_RET4(handle, FFA_MSG_SEND2, sender_receiver, 0,
+				 size);
+		}
+	}
+
 	/* Update the state of the SP execution context. */
 	sp->ec[idx].rt_state = RT_STATE_WAITING;
 
@@ -479,6 +510,7 @@ static uint64_t msg_wait_handler(uint32_t smc_fid,
 		unsigned int secure_state_in = SECURE;
 		unsigned int secure_state_out = NON_SECURE;
 
+		spmc_notif_sri_flush();
 		cm_el1_sysregs_context_save(secure_state_in);
 		cm_el1_sysregs_context_restore(secure_state_out);
 		cm_set_next_eret_context(secure_state_out);
@@ -835,67 +867,120 @@ static int partition_info_get_handler_v1_1(uint32_t *uuid,
 }
 
 /*
- * Handle the case where that caller only wants the count of partitions
- * matching a given UUID and does not want the corresponding descriptors
- * populated.
+ * Partition information is immutable once the SPMC has been set up, so the
+ * FFA_PARTITION_INFO_GET responses are built once in both descriptor formats.
+ * The first part of each array holds the response to a request with the nil
+ * UUID. The second part holds the responses to requests with a specific UUID,
+ * grouped by UUID and with the UUID field cleared, so that each response is a
+ * contiguous range of descriptors.
  */
-static uint32_t partition_info_get_handler_count_only(uint32_t *uuid)
+struct partition_info_range {
+	uint32_t uuid[4];
+	uint32_t start;
+	uint32_t count;
+};
+
+static struct ffa_partition_info_v1_1
+	partition_info_v1_1[2U * MAX_SP_LP_PARTITIONS];
+static struct ffa_partition_info_v1_0
+	partition_info_v1_0[2U * MAX_SP_LP_PARTITIONS];
+static struct partition_info_range partition_info_ranges[MAX_SP_LP_PARTITIONS];
+static uint32_t partition_info_range_count;
+static uint32_t partition_info_count;
+
+/*
+ * Build the FFA_PARTITION_INFO_GET responses. Must be called once all the
+ * partition descriptors have been initialised.
+ */
+static int partition_info_cache_init(void)
 {
-	uint32_t index = 0;
-	uint32_t partition_count = 0;
-	bool null_uuid = is_null_uuid(uuid);
-	struct el3_lp_desc *el3_lp_descs = get_el3_lp_array();
+	uint32_t null_uuid[4] = { 0 };
+	uint32_t index, match, next;
+	struct partition_info_range *range;
+	int ret;
 
-	/* Deal with Logical Partitions. */
-	for (index = 0U; index < EL3_LP_DESCS_COUNT; index++) {
-		if (null_uuid ||
-		    uuid_match(uuid, el3_lp_descs[index].uuid)) {
-			(partition_count)++;
-		}
+	(void)memset(partition_info_v1_1, 0, sizeof(partition_info_v1_1));
+	partition_info_count = 0U;
+	ret = partition_info_get_handler_v1_1(null_uuid, partition_info_v1_1,
+					      MAX_SP_LP_PARTITIONS,
+					      &partition_info_count);
+	if (ret != 0) {
+		return ret;
 	}
 
-	/* Deal with physical SP's. */
-	for (index = 0U; index < SECURE_PARTITION_COUNT; index++) {
-		if (null_uuid || uuid_match(uuid, sp_desc[index].uuid)) {
-			(partition_count)++;
+	/* Group the descriptors by UUID, keeping the discovery order. */
+	next = partition_info_count;
+	partition_info_range_count = 0U;
+	for (index = 0U; index < partition_info_count; index++) {
+		bool found = false;
+
+		for (match = 0U; match < partition_info_range_count; match++) {
+			if (uuid_match(partition_info_ranges[match].uuid,
+				       partition_info_v1_1[index].uuid)) {
+				found = true;
+				break;
+			}
+		}
+		if (found) {
+			continue;
 		}
+
+		range = &partition_info_ranges[partition_info_range_count++];
+		copy_uuid(range->uuid, partition_info_v1_1[index].uuid);
+		range->start = next;
+		range->count = 0U;
+
+		for (match = index; match < partition_info_count; match++) {
+			if (!uuid_match(range->uuid,
+					partition_info_v1_1[match].uuid)) {
+				continue;
+			}
+			partition_info_v1_1[next] = partition_info_v1_1[match];
+			(void)memset(partition_info_v1_1[next].uuid, 0,
+				     sizeof(partition_info_v1_1[next].uuid));
+			next++;
+			range->count++;
+		}
+	}
+
+	/* Derive the v1.0 descriptors, which only report v1.0 properties. */
+	for (index = 0U; index < next; index++) {
+		partition_info_v1_0[index].ep_id =
+			partition_info_v1_1[index].ep_id;
+		partition_info_v1_0[index].execution_ctx_count =
+			partition_info_v1_1[index].execution_ctx_count;
+		partition_info_v1_0[index].properties =
+			partition_info_v1_1[index].properties &
+			FFA_PARTITION_INFO_GET_PROPERTIES_V1_0_MASK;
 	}
-	return partition_count;
+
+	return 0;
 }
 
 /*
- * If the caller of the PARTITION_INFO_GET ABI was a v1.0 caller, populate
- * the corresponding descriptor format from the v1.1 descriptor array.
+ * Find the range of prebuilt descriptors matching a given UUID. Returns false
+ * if no partition matches.
  */
-static uint64_t partition_info_populate_v1_0(struct ffa_partition_info_v1_1
-					     *partitions,
-					     struct mailbox *mbox,
-					     int partition_count)
+static bool partition_info_cache_lookup(uint32_t *uuid, uint32_t *start,
+					uint32_t *count)
 {
 	uint32_t index;
-	uint32_t buf_size;
-	uint32_t descriptor_size;
-	struct ffa_partition_info_v1_0 *v1_0_partitions =
-		(struct ffa_partition_info_v1_0 *) mbox->rx_buffer;
 
-	buf_size = mbox->rxtx_page_count * FFA_PAGE_SIZE;
-	descriptor_size = partition_count *
-			  sizeof(struct ffa_partition_info_v1_0);
-
-	if (descriptor_size > buf_size) {
-		return FFA_ERROR_NO_MEMORY;
+	if (is_null_uuid(uuid)) {
+		*start = 0U;
+		*count = partition_info_count;
+		return partition_info_count != 0U;
 	}
 
-	for (index = 0U; index < partition_count; index++) {
-		v1_0_partitions[index].ep_id = partitions[index].ep_id;
-		v1_0_partitions[index].execution_ctx_count =
-			partitions[index].execution_ctx_count;
-		/* Only report v1.0 properties. */
-		v1_0_partitions[index].properties =
-			(partitions[index].properties &
-			FFA_PARTITION_INFO_GET_PROPERTIES_V1_0_MASK);
+	for (index = 0U; index < partition_info_range_count; index++) {
+		if (uuid_match(uuid, partition_info_ranges[index].uuid)) {
+			*start = partition_info_ranges[index].start;
+			*count = partition_info_ranges[index].count;
+			return true;
+		}
 	}
-	return 0;
+
+	return false;
 }
 
 /*
@@ -913,6 +998,7 @@ static uint64_t partition_info_get_handler(uint32_t smc_fid,
 					   uint64_t flags)
 {
 	int ret;
+	uint32_t partition_start = 0;
 	uint32_t partition_count = 0;
 	uint32_t size = 0;
 	uint32_t ffa_version = get_partition_ffa_version(secure_origin);
@@ -920,6 +1006,8 @@ static uint64_t partition_info_get_handler(uint32_t smc_fid,
 	uint64_t info_get_flags;
 	bool count_only;
 	uint32_t uuid[4];
+	const void *descriptors;
+	size_t desc_size;
 
 	uuid[0] = x1;
 	uuid[1] = x2;
@@ -930,37 +1018,28 @@ static uint64_t partition_info_get_handler(uint32_t smc_fid,
 	info_get_flags = SMC_GET_GP(handle, CTX_GPREG_X5);
 	count_only = (info_get_flags & FFA_PARTITION_INFO_GET_COUNT_FLAG_MASK);
 
-	/* Handle the case where we don't need to populate the descriptors. */
-	if (count_only) {
-		partition_count = partition_info_get_handler_count_only(uuid);
-		if (partition_count == 0) {
-			return spmc_ffa_error_return(handle,
-						FFA_ERROR_INVALID_PARAMETER);
-		}
-	} else {
-		struct ffa_partition_info_v1_1 partitions[MAX_SP_LP_PARTITIONS];
+	/* If we didn't find any matches the UUID is unknown. */
+	if (!partition_info_cache_lookup(uuid, &partition_start,
+					 &partition_count)) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
 
+	/* Handle the case where the partition descriptors are required. */
+	if (!count_only) {
 		/*
-		 * Handle the case where the partition descriptors are required,
-		 * check we have the buffers available and populate the
-		 * appropriate structure version.
+		 * Depending on the FF-A version of the requesting partition
+		 * select the prebuilt v1.0 or v1.1 descriptors.
 		 */
-
-		/* Obtain the v1.1 format of the descriptors. */
-		ret = partition_info_get_handler_v1_1(uuid, partitions,
-						      MAX_SP_LP_PARTITIONS,
-						      &partition_count);
-
-		/* Check if an error occurred during discovery. */
-		if (ret != 0) {
-			goto err;
-		}
-
-		/* If we didn't find any matches the UUID is unknown. */
-		if (partition_count == 0) {
-			ret = FFA_ERROR_INVALID_PARAMETER;
-			goto err;
+		if (ffa_version == MAKE_FFA_VERSION(U(1), U(0))) {
+			desc_size = sizeof(struct ffa_partition_info_v1_0);
+			descriptors = &partition_info_v1_0[partition_start];
+		} else {
+			size = sizeof(struct ffa_partition_info_v1_1);
+			desc_size = size;
+			descriptors = &partition_info_v1_1[partition_start];
 		}
+		desc_size *= partition_count;
 
 		/* Obtain the partition mailbox RX/TX buffer pair descriptor. */
 		mbox = spmc_get_mbox_desc(secure_origin);
@@ -981,36 +1060,14 @@ static uint64_t partition_info_get_handler(uint32_t smc_fid,
 			goto err_unlock;
 		}
 
-		/* Zero the RX buffer before populating. */
-		(void)memset(mbox->rx_buffer, 0,
-			     mbox->rxtx_page_count * FFA_PAGE_SIZE);
-
-		/*
-		 * Depending on the FF-A version of the requesting partition
-		 * we may need to convert to a v1.0 format otherwise we can copy
-		 * directly.
-		 */
-		if (ffa_version == MAKE_FFA_VERSION(U(1), U(0))) {
-			ret = partition_info_populate_v1_0(partitions,
-							   mbox,
-							   partition_count);
-			if (ret != 0) {
-				goto err_unlock;
-			}
-		} else {
-			uint32_t buf_size = mbox->rxtx_page_count *
-					    FFA_PAGE_SIZE;
-
-			/* Ensure the descriptor will fit in the buffer. */
-			size = sizeof(struct ffa_partition_info_v1_1);
-			if (partition_count * size  > buf_size) {
-				ret = FFA_ERROR_NO_MEMORY;
-				goto err_unlock;
-			}
-			memcpy(mbox->rx_buffer, partitions,
-			       partition_count * size);
+		/* Ensure the descriptors will fit in the buffer. */
+		if (desc_size > (mbox->rxtx_page_count * FFA_PAGE_SIZE)) {
+			ret = FFA_ERROR_NO_MEMORY;
+			goto err_unlock;
 		}
 
+		(void)memcpy(mbox->rx_buffer, descriptors, desc_size);
+
 		mbox->state = MAILBOX_STATE_FULL;
 		spin_unlock(&mbox->lock);
 	}
@@ -1018,7 +1075,6 @@ static uint64_t partition_info_get_handler(uint32_t smc_fid,
 
 err_unlock:
 	spin_unlock(&mbox->lock);
-err:
 	return spmc_ffa_error_return(handle, ret);
 }
 
@@ -1084,7 +1140,15 @@ static uint64_t ffa_features_handler(uint32_t smc_fid,
 
 	/* Check if a Feature ID was requested. */
 	if ((function_id & FFA_FEATURES_BIT31_MASK) == 0U) {
-		/* We currently don't support any additional features. */
+		/*
+		 * Report the Schedule Receiver Interrupt to the Normal world
+		 * scheduler. The Notification Pending Interrupt is not
+		 * supported.
+		 */
+		if ((function_id == FFA_FEATURE_SRI) && !secure_origin) {
+			SMC_RET3(handle, FFA_SUCCESS_SMC32, 0,
+				 SPMC_SRI_SGI_ID);
+		}
 		return spmc_ffa_error_return(handle, FFA_ERROR_NOT_SUPPORTED);
 	}
 
@@ -1128,6 +1192,11 @@ static uint64_t ffa_features_handler(uint32_t smc_fid,
 	case FFA_RXTX_UNMAP:
 	case FFA_MEM_FRAG_TX:
 	case FFA_MSG_RUN:
+	case FFA_MSG_SEND2:
+	case FFA_NOTIFICATION_BIND:
+	case FFA_NOTIFICATION_UNBIND:
+	case FFA_NOTIFICATION_SET:
+	case FFA_NOTIFICATION_GET:
 
 		/*
 		 * We are relying on the fact that the other registers
@@ -1161,6 +1230,10 @@ static uint64_t ffa_features_handler(uint32_t smc_fid,
 	case FFA_MEM_LEND_SMC64:
 	case FFA_MEM_RECLAIM:
 	case FFA_MEM_FRAG_RX:
+	case FFA_NOTIFICATION_BITMAP_CREATE:
+	case FFA_NOTIFICATION_BITMAP_DESTROY:
+	case FFA_NOTIFICATION_INFO_GET:
+	case FFA_NOTIFICATION_INFO_GET_SMC64:
 
 		if (secure_origin) {
 			return spmc_ffa_error_return(handle,
@@ -1281,9 +1354,22 @@ static uint64_t ffa_run_handler(uint32_t smc_fid,
 
 	/*
 	 * If the context was waiting then update the partition runtime model.
+	 * Deliver the oldest indirect message queued for the SP, if any, and
+	 * resume it with the details of the message instead of FFA_RUN.
 	 */
 	if (*rt_state == RT_STATE_WAITING) {
+		uint32_t sender_receiver;
+		uint32_t size;
+
 		*rt_model = RT_MODEL_RUN;
+
+		if (spmc_msg_deliver(sp, &sender_receiver, &size)) {
+			*rt_state = RT_STATE_RUNNING;
+			return spmc_smc_return(FFA_MSG_SEND2, secure_origin,
+					       sender_receiver, 0, size, 0,
+					       handle, cookie, flags,
+					       target_id);
+		}
 	}
 
 	/*
@@ -1316,6 +1402,7 @@ static uint64_t rx_release_handler(uint32_t smc_fid,
 	}
 
 	mbox->state = MAILBOX_STATE_EMPTY;
+	mbox->indirect_msg = false;
 	spin_unlock(&mbox->lock);
 
 	SMC_RET1(handle, FFA_SUCCESS_SMC32);
@@ -1509,6 +1596,12 @@ static int sp_manifest_parse(void *sp_manifest, int offset,
 		return -EINVAL;
 	}
 
+	/*
+	 * Per-vCPU notifications of an SP are indexed by its execution
+	 * contexts. An S-EL0 SP only ever has a single one.
+	 */
+	sp->notif.vcpu_count = (sp->runtime_el == S_EL0) ? 1U : config_32;
+
 	/*
 	 * Look for the optional fields that are expected to be present in
 	 * an SP manifest.
@@ -1759,6 +1852,7 @@ static void initalize_sp_descs(void)
 		sp->mailbox.tx_buffer = NULL;
 		sp->mailbox.state = MAILBOX_STATE_EMPTY;
 		sp->secondary_ep = 0;
+		sp->notif.vcpu_count = 0U;
 	}
 }
 
@@ -1836,6 +1930,13 @@ int32_t spmc_setup(void)
 		return ret;
 	}
 
+	/* Prebuild the FFA_PARTITION_INFO_GET responses. */
+	ret = partition_info_cache_init();
+	if (ret != 0) {
+		ERROR("Failed to build partition information (%d).\n", ret);
+		return ret;
+	}
+
 	/* Register power management hooks with PSCI */
 	psci_register_spd_pm_hook(&spmc_pm);
 
@@ -1926,6 +2027,22 @@ uint64_t spmc_smc_handler(uint32_t smc_fid,
 		return rx_release_handler(smc_fid, secure_origin, x1, x2, x3,
 					  x4, cookie, handle, flags);
 
+	case FFA_MSG_SEND2:
+		return spmc_ffa_msg_send2(smc_fid, secure_origin, x1, x2, x3,
+					  x4, cookie, handle, flags);
+
+	case FFA_NOTIFICATION_BITMAP_CREATE:
+	case FFA_NOTIFICATION_BITMAP_DESTROY:
+	case FFA_NOTIFICATION_BIND:
+	case FFA_NOTIFICATION_UNBIND:
+	case FFA_NOTIFICATION_SET:
+	case FFA_NOTIFICATION_GET:
+	case FFA_NOTIFICATION_INFO_GET:
+	case FFA_NOTIFICATION_INFO_GET_SMC64:
+		return spmc_ffa_notification_handler(smc_fid, secure_origin,
+						     x1, x2, x3, x4, cookie,
+						     handle, flags);
+
 	case FFA_MSG_WAIT:
 		return msg_wait_handler(smc_fid, secure_origin, x1, x2, x3, x4,
 					cookie, handle, flags);
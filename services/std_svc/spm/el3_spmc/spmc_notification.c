@@ -0,0 +1,723 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <assert.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <common/runtime_svc.h>
+#include <lib/spinlock.h>
+#include <plat/common/platform.h>
+#include <services/ffa_svc.h>
+#include "spmc.h"
+
+#include <platform_def.h>
+
+/* FFA_NOTIFICATION_BIND and FFA_NOTIFICATION_SET flags. */
+#define FFA_NOTIFICATION_FLAG_PER_VCPU		BIT(0)
+#define FFA_NOTIFICATION_FLAG_DELAY_SRI		BIT(1)
+#define FFA_NOTIFICATION_SET_VCPU_SHIFT		U(16)
+
+/* FFA_NOTIFICATION_GET flags. */
+#define FFA_NOTIFICATION_GET_FROM_SP		BIT(0)
+#define FFA_NOTIFICATION_GET_FROM_VM		BIT(1)
+#define FFA_NOTIFICATION_GET_FROM_SPM		BIT(2)
+#define FFA_NOTIFICATION_GET_FROM_HYP		BIT(3)
+#define FFA_NOTIFICATION_GET_VCPU_SHIFT		U(16)
+
+/* FFA_NOTIFICATION_INFO_GET return values. */
+#define FFA_NOTIF_INFO_MORE_PENDING		BIT(0)
+#define FFA_NOTIF_INFO_LIST_COUNT_SHIFT		U(7)
+#define FFA_NOTIF_INFO_LIST_SIZE_SHIFT(_l)	(U(12) + (U(2) * (_l)))
+#define FFA_NOTIF_INFO_MAX_LIST_VCPUS		U(3)
+#define FFA_NOTIF_INFO_MAX_IDS_32		U(10)
+#define FFA_NOTIF_INFO_MAX_IDS_64		U(20)
+#define FFA_NOTIF_INFO_MAX_LISTS_32		U(10)
+#define FFA_NOTIF_INFO_MAX_LISTS_64		U(20)
+
+#define NOTIF_ALL_VCPUS		(~0ULL >> (64U - PLATFORM_CORE_COUNT))
+
+/* Notification state of a Normal world VM. */
+struct spmc_vm_notif {
+	bool created;
+	uint16_t vm_id;
+	struct spmc_notif_state notif;
+};
+
+static struct spmc_vm_notif vm_notif[NS_PARTITION_COUNT];
+static spinlock_t vm_notif_lock;
+
+/* Schedule Receiver Interrupts delayed until the return to the Normal world. */
+static bool sri_delayed[PLATFORM_CORE_COUNT];
+
+/*******************************************************************************
+ * Atomic updates of the pending notification bitmaps.
+ ******************************************************************************/
+static inline void notif_atomic_or(volatile uint64_t *addr, uint64_t bits)
+{
+#if USE_SPINLOCK_CAS
+	__asm__ volatile("stsetl	%1, %0"
+			 : "+Q" (*addr)
+			 : "r" (bits)
+			 : "memory");
+#else
+	uint64_t tmp;
+	uint32_t fail;
+
+	__asm__ volatile("1:	ldxr	%0, %2\n"
+			 "	orr	%0, %0, %3\n"
+			 "	stlxr	%w1, %0, %2\n"
+			 "	cbnz	%w1, 1b\n"
+			 : "=&r" (tmp), "=&r" (fail), "+Q" (*addr)
+			 : "r" (bits)
+			 : "memory");
+#endif
+}
+
+/* Clear 'bits' and return those that were set. */
+static inline uint64_t notif_atomic_fetch_clear(volatile uint64_t *addr,
+						uint64_t bits)
+{
+	uint64_t old;
+#if USE_SPINLOCK_CAS
+	__asm__ volatile("ldclral	%2, %0, %1"
+			 : "=r" (old), "+Q" (*addr)
+			 : "r" (bits)
+			 : "memory");
+#else
+	uint64_t tmp;
+	uint32_t fail;
+
+	__asm__ volatile("1:	ldaxr	%0, %3\n"
+			 "	bic	%1, %0, %4\n"
+			 "	stlxr	%w2, %1, %3\n"
+			 "	cbnz	%w2, 1b\n"
+			 : "=&r" (old), "=&r" (tmp), "=&r" (fail), "+Q" (*addr)
+			 : "r" (bits)
+			 : "memory");
+#endif
+	return old & bits;
+}
+
+/*******************************************************************************
+ * Helper functions.
+ ******************************************************************************/
+
+/*
+ * Obtain the notification state of an SP or of a VM with a bitmap, and take its
+ * lock. The lookup of a VM is done with vm_notif_lock held until the lock of
+ * the state is taken, so that the bitmap cannot be destroyed in between.
+ */
+static struct spmc_notif_state *notif_lock_state(uint16_t id)
+{
+	struct secure_partition_desc *sp;
+	struct spmc_notif_state *notif = NULL;
+	unsigned int i;
+
+	if (ffa_is_secure_world_id(id)) {
+		sp = spmc_get_sp_ctx(id);
+		if (sp == NULL) {
+			return NULL;
+		}
+
+		spin_lock(&sp->notif.lock);
+		return &sp->notif;
+	}
+
+	spin_lock(&vm_notif_lock);
+	for (i = 0U; i < NS_PARTITION_COUNT; i++) {
+		if (vm_notif[i].created && (vm_notif[i].vm_id == id)) {
+			notif = &vm_notif[i].notif;
+			spin_lock(&notif->lock);
+			break;
+		}
+	}
+	spin_unlock(&vm_notif_lock);
+
+	return notif;
+}
+
+/*
+ * Check that the caller can act on behalf of an endpoint: an SP for itself, or
+ * the Normal world for any of its endpoints.
+ */
+static bool notif_caller_is(bool secure_origin, uint16_t id)
+{
+	if (secure_origin) {
+		return spmc_get_current_sp_ctx()->sp_id == id;
+	}
+
+	return ffa_is_normal_world_id(id);
+}
+
+static void notif_raise_sri(bool delay)
+{
+	unsigned int core = plat_my_core_pos();
+
+	if (delay) {
+		sri_delayed[core] = true;
+		return;
+	}
+
+	sri_delayed[core] = false;
+	plat_ic_raise_ns_sgi(SPMC_SRI_SGI_ID, read_mpidr_el1());
+}
+
+void spmc_notif_sri_flush(void)
+{
+	unsigned int core = plat_my_core_pos();
+
+	if (sri_delayed[core]) {
+		notif_raise_sri(false);
+	}
+}
+
+void spmc_notif_fwk_set(struct secure_partition_desc *sp, uint64_t bits)
+{
+	notif_atomic_or(&sp->notif.pending_fwk, bits);
+	notif_atomic_or(&sp->notif.info_global, 1ULL);
+	notif_raise_sri(false);
+}
+
+/*******************************************************************************
+ * FFA_NOTIFICATION_BITMAP_CREATE and FFA_NOTIFICATION_BITMAP_DESTROY. Only the
+ * Normal world can call them, for its VMs. The SPs have a bitmap from boot.
+ ******************************************************************************/
+static uint64_t notif_bitmap_create(bool secure_origin, uint64_t x1,
+				    uint64_t x2, void *handle)
+{
+	uint16_t vm_id = (uint16_t)(x1 & FFA_ID_MASK);
+	uint32_t vcpu_count = (uint32_t)x2;
+	struct spmc_vm_notif *free_vm = NULL;
+	unsigned int i;
+	int ret = 0;
+
+	if (secure_origin) {
+		return spmc_ffa_error_return(handle, FFA_ERROR_NOT_SUPPORTED);
+	}
+
+	if (!ffa_is_normal_world_id(vm_id) || (vcpu_count == 0U) ||
+	    (vcpu_count > PLATFORM_CORE_COUNT)) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	spin_lock(&vm_notif_lock);
+	for (i = 0U; i < NS_PARTITION_COUNT; i++) {
+		if (!vm_notif[i].created) {
+			free_vm = (free_vm == NULL) ? &vm_notif[i] : free_vm;
+		} else if (vm_notif[i].vm_id == vm_id) {
+			ret = FFA_ERROR_DENIED;
+			break;
+		}
+	}
+
+	if ((ret == 0) && (free_vm == NULL)) {
+		ret = FFA_ERROR_NO_MEMORY;
+	}
+
+	if (ret == 0) {
+		(void)memset(&free_vm->notif, 0, sizeof(free_vm->notif));
+		free_vm->notif.vcpu_count = vcpu_count;
+		free_vm->vm_id = vm_id;
+		free_vm->created = true;
+	}
+	spin_unlock(&vm_notif_lock);
+
+	if (ret != 0) {
+		return spmc_ffa_error_return(handle, ret);
+	}
+
+	SMC_RET1(handle, FFA_SUCCESS_SMC32);
+}
+
+static uint64_t notif_bitmap_destroy(bool secure_origin, uint64_t x1,
+				     void *handle)
+{
+	uint16_t vm_id = (uint16_t)(x1 & FFA_ID_MASK);
+	struct spmc_notif_state *notif;
+	unsigned int i;
+	int ret = FFA_ERROR_INVALID_PARAMETER;
+
+	if (secure_origin) {
+		return spmc_ffa_error_return(handle, FFA_ERROR_NOT_SUPPORTED);
+	}
+
+	spin_lock(&vm_notif_lock);
+	for (i = 0U; i < NS_PARTITION_COUNT; i++) {
+		if (!vm_notif[i].created || (vm_notif[i].vm_id != vm_id)) {
+			continue;
+		}
+
+		/* Notifications must not be bound or pending. */
+		notif = &vm_notif[i].notif;
+		spin_lock(&notif->lock);
+		if ((notif->bound != 0ULL) || (notif->pending != 0ULL) ||
+		    (notif->info_vcpu != 0ULL)) {
+			ret = FFA_ERROR_DENIED;
+		} else {
+			vm_notif[i].created = false;
+			ret = 0;
+		}
+		spin_unlock(&notif->lock);
+		break;
+	}
+	spin_unlock(&vm_notif_lock);
+
+	if (ret != 0) {
+		return spmc_ffa_error_return(handle, ret);
+	}
+
+	SMC_RET1(handle, FFA_SUCCESS_SMC32);
+}
+
+/*******************************************************************************
+ * FFA_NOTIFICATION_BIND and FFA_NOTIFICATION_UNBIND, called by the receiver
+ * to allow or forbid a sender to signal a set of notifications.
+ ******************************************************************************/
+static uint64_t notif_bind(uint32_t smc_fid, bool secure_origin, uint64_t x1,
+			   uint64_t x2, uint64_t x3, uint64_t x4,
+			   void *handle)
+{
+	uint16_t sender_id = FFA_RXTX_HEADER_SENDER(x1);
+	uint16_t receiver_id = FFA_RXTX_HEADER_RECEIVER(x1);
+	uint64_t bits = (x4 << 32) | (x3 & 0xFFFFFFFFULL);
+	bool bind = (smc_fid == FFA_NOTIFICATION_BIND);
+	bool per_vcpu = ((x2 & FFA_NOTIFICATION_FLAG_PER_VCPU) != 0U);
+	struct spmc_notif_state *notif;
+	uint64_t pending_vcpu = 0ULL;
+	uint64_t remaining;
+	unsigned int i;
+	int ret = 0;
+
+	if (!notif_caller_is(secure_origin, receiver_id) ||
+	    (sender_id == receiver_id) || (bits == 0ULL)) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	/*
+	 * A secure sender must be an SP. The Normal world can only bind
+	 * notifications from an SP.
+	 */
+	if (ffa_is_secure_world_id(sender_id)) {
+		if (spmc_get_sp_ctx(sender_id) == NULL) {
+			return spmc_ffa_error_return(handle,
+						FFA_ERROR_INVALID_PARAMETER);
+		}
+	} else if (ffa_is_normal_world_id(receiver_id)) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	if ((bind && ((x2 & ~FFA_NOTIFICATION_FLAG_PER_VCPU) != 0U)) ||
+	    (!bind && (x2 != 0U))) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	notif = notif_lock_state(receiver_id);
+	if (notif == NULL) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	if (bind) {
+		if ((notif->bound & bits) != 0ULL) {
+			ret = FFA_ERROR_DENIED;
+			goto out;
+		}
+	} else {
+		/* All the notifications must be bound to this sender. */
+		remaining = bits;
+		while (remaining != 0ULL) {
+			i = __builtin_ctzll(remaining);
+			remaining &= remaining - 1ULL;
+			if (((notif->bound & BIT_64(i)) == 0ULL) ||
+			    (notif->sender[i] != sender_id)) {
+				ret = FFA_ERROR_DENIED;
+				goto out;
+			}
+		}
+
+		/* They must not be pending. */
+		for (i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+			pending_vcpu |= notif->pending_vcpu[i];
+		}
+		if (((notif->pending | pending_vcpu) & bits) != 0ULL) {
+			ret = FFA_ERROR_DENIED;
+			goto out;
+		}
+	}
+
+	remaining = bits;
+	while (remaining != 0ULL) {
+		i = __builtin_ctzll(remaining);
+		remaining &= remaining - 1ULL;
+		notif->sender[i] = bind ? sender_id : 0U;
+	}
+
+	if (bind) {
+		notif->bound |= bits;
+		if (ffa_is_secure_world_id(sender_id)) {
+			notif->bound_sp |= bits;
+		}
+		if (per_vcpu) {
+			notif->bound_per_vcpu |= bits;
+		}
+	} else {
+		notif->bound &= ~bits;
+		notif->bound_sp &= ~bits;
+		notif->bound_per_vcpu &= ~bits;
+	}
+
+out:
+	spin_unlock(&notif->lock);
+
+	if (ret != 0) {
+		return spmc_ffa_error_return(handle, ret);
+	}
+
+	SMC_RET1(handle, FFA_SUCCESS_SMC32);
+}
+
+/*******************************************************************************
+ * FFA_NOTIFICATION_SET, called by a sender. The bindings are checked and the
+ * notifications made pending with the lock of the receiver held, so that they
+ * cannot be unbound, or the bitmap of a VM destroyed, in between.
+ ******************************************************************************/
+static uint64_t notif_set(bool secure_origin, uint64_t x1, uint64_t x2,
+			  uint64_t x3, uint64_t x4, void *handle)
+{
+	uint16_t sender_id = FFA_RXTX_HEADER_SENDER(x1);
+	uint16_t receiver_id = FFA_RXTX_HEADER_RECEIVER(x1);
+	uint64_t bits = (x4 << 32) | (x3 & 0xFFFFFFFFULL);
+	uint32_t vcpu = (uint32_t)((x2 >> FFA_NOTIFICATION_SET_VCPU_SHIFT) &
+				   FFA_ID_MASK);
+	bool per_vcpu = ((x2 & FFA_NOTIFICATION_FLAG_PER_VCPU) != 0U);
+	bool delay_sri = ((x2 & FFA_NOTIFICATION_FLAG_DELAY_SRI) != 0U);
+	struct spmc_notif_state *notif;
+	uint64_t remaining;
+	unsigned int i;
+	int ret = 0;
+
+	if (!notif_caller_is(secure_origin, sender_id) ||
+	    (sender_id == receiver_id) || (bits == 0ULL) ||
+	    ((x2 & ~(FFA_NOTIFICATION_FLAG_PER_VCPU |
+		     FFA_NOTIFICATION_FLAG_DELAY_SRI |
+		     (FFA_ID_MASK << FFA_NOTIFICATION_SET_VCPU_SHIFT))) != 0U)) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	/* Only an SP can delay the Schedule Receiver Interrupt. */
+	if (delay_sri && !secure_origin) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	if (!per_vcpu && (vcpu != 0U)) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	notif = notif_lock_state(receiver_id);
+	if (notif == NULL) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	if (per_vcpu && (vcpu >= notif->vcpu_count)) {
+		ret = FFA_ERROR_INVALID_PARAMETER;
+		goto out;
+	}
+
+	/*
+	 * The notifications must be bound to the sender, with the same
+	 * per-vCPU attribute.
+	 */
+	if (((notif->bound & bits) != bits) ||
+	    ((per_vcpu ? ~notif->bound_per_vcpu : notif->bound_per_vcpu) &
+	     bits) != 0ULL) {
+		ret = FFA_ERROR_DENIED;
+		goto out;
+	}
+
+	remaining = bits;
+	while (remaining != 0ULL) {
+		i = __builtin_ctzll(remaining);
+		remaining &= remaining - 1ULL;
+		if (notif->sender[i] != sender_id) {
+			ret = FFA_ERROR_DENIED;
+			goto out;
+		}
+	}
+
+	if (per_vcpu) {
+		notif_atomic_or(&notif->pending_vcpu[vcpu], bits);
+		notif_atomic_or(&notif->info_vcpu, BIT_64(vcpu));
+	} else {
+		notif_atomic_or(&notif->pending, bits);
+		notif_atomic_or(&notif->info_global, 1ULL);
+	}
+
+out:
+	spin_unlock(&notif->lock);
+
+	if (ret != 0) {
+		return spmc_ffa_error_return(handle, ret);
+	}
+
+	/* Let the Normal world scheduler know that the receiver has work. */
+	notif_raise_sri(delay_sri);
+
+	SMC_RET1(handle, FFA_SUCCESS_SMC32);
+}
+
+/*******************************************************************************
+ * FFA_NOTIFICATION_GET, called by a receiver to retrieve and clear its pending
+ * notifications.
+ ******************************************************************************/
+static uint64_t notif_get(bool secure_origin, uint64_t x1, uint64_t x2,
+			  void *handle)
+{
+	uint16_t receiver_id = (uint16_t)(x1 & FFA_ID_MASK);
+	uint32_t vcpu = (uint32_t)((x1 >> FFA_NOTIFICATION_GET_VCPU_SHIFT) &
+				   FFA_ID_MASK);
+	struct spmc_notif_state *notif;
+	uint64_t from_sp = 0ULL;
+	uint64_t from_vm = 0ULL;
+	uint64_t from_spm = 0ULL;
+	uint64_t sp_mask;
+
+	if (!notif_caller_is(secure_origin, receiver_id) ||
+	    ((x2 & ~(FFA_NOTIFICATION_GET_FROM_SP |
+		     FFA_NOTIFICATION_GET_FROM_VM |
+		     FFA_NOTIFICATION_GET_FROM_SPM |
+		     FFA_NOTIFICATION_GET_FROM_HYP)) != 0U)) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	/*
+	 * An SP can only retrieve the notifications of its current execution
+	 * context, which is always 0 for UP and S-EL0 SPs.
+	 */
+	if (secure_origin &&
+	    (vcpu != get_ec_index(spmc_get_current_sp_ctx()))) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	notif = notif_lock_state(receiver_id);
+	if (notif == NULL) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	if (vcpu >= notif->vcpu_count) {
+		spin_unlock(&notif->lock);
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	sp_mask = notif->bound_sp;
+	if ((x2 & FFA_NOTIFICATION_GET_FROM_SP) != 0U) {
+		from_sp = notif_atomic_fetch_clear(&notif->pending, sp_mask) |
+			  notif_atomic_fetch_clear(&notif->pending_vcpu[vcpu],
+						   sp_mask);
+	}
+	if ((x2 & FFA_NOTIFICATION_GET_FROM_VM) != 0U) {
+		from_vm = notif_atomic_fetch_clear(&notif->pending, ~sp_mask) |
+			  notif_atomic_fetch_clear(&notif->pending_vcpu[vcpu],
+						   ~sp_mask);
+	}
+	if ((x2 & FFA_NOTIFICATION_GET_FROM_SPM) != 0U) {
+		from_spm = notif_atomic_fetch_clear(&notif->pending_fwk,
+						    ~0ULL);
+	}
+
+	spin_unlock(&notif->lock);
+
+	SMC_RET8(handle, FFA_SUCCESS_SMC32, 0,
+		 from_sp & 0xFFFFFFFFULL, from_sp >> 32,
+		 from_vm & 0xFFFFFFFFULL, from_vm >> 32,
+		 from_spm, 0);
+}
+
+/*******************************************************************************
+ * FFA_NOTIFICATION_INFO_GET, called by the Normal world scheduler to find out
+ * which endpoints and vCPUs have pending notifications that have not been
+ * reported yet.
+ ******************************************************************************/
+struct notif_info {
+	uint16_t ids[FFA_NOTIF_INFO_MAX_IDS_64];
+	uint32_t id_count;
+	uint32_t max_ids;
+	uint32_t list_count;
+	uint32_t max_lists;
+	uint64_t flags;
+};
+
+/* Add a list made of an endpoint ID and up to three vCPU IDs. */
+static bool notif_info_add_list(struct notif_info *info, uint16_t id,
+				const uint16_t *vcpus, uint32_t vcpu_count)
+{
+	uint32_t i;
+
+	if ((info->list_count == info->max_lists) ||
+	    ((info->id_count + 1U + vcpu_count) > info->max_ids)) {
+		info->flags |= FFA_NOTIF_INFO_MORE_PENDING;
+		return false;
+	}
+
+	info->ids[info->id_count++] = id;
+	for (i = 0U; i < vcpu_count; i++) {
+		info->ids[info->id_count++] = vcpus[i];
+	}
+	info->flags |= (uint64_t)vcpu_count <<
+		       FFA_NOTIF_INFO_LIST_SIZE_SHIFT(info->list_count);
+	info->list_count++;
+
+	return true;
+}
+
+static void notif_info_add(struct notif_info *info, uint16_t id,
+			   struct spmc_notif_state *notif)
+{
+	uint16_t vcpus[FFA_NOTIF_INFO_MAX_LIST_VCPUS];
+	uint32_t count;
+	uint64_t mask;
+	uint64_t remaining;
+	unsigned int vcpu;
+
+	/* Skip notifications retrieved since they were signalled. */
+	if ((notif_atomic_fetch_clear(&notif->info_global, 1ULL) != 0ULL) &&
+	    ((notif->pending | notif->pending_fwk) != 0ULL)) {
+		if (!notif_info_add_list(info, id, NULL, 0U)) {
+			notif_atomic_or(&notif->info_global, 1ULL);
+			return;
+		}
+	}
+
+	/* Report the vCPUs with pending notifications, three per list. */
+	mask = notif_atomic_fetch_clear(&notif->info_vcpu, NOTIF_ALL_VCPUS);
+	while (mask != 0ULL) {
+		count = 0U;
+		remaining = mask;
+		while ((remaining != 0ULL) &&
+		       (count < FFA_NOTIF_INFO_MAX_LIST_VCPUS)) {
+			vcpu = __builtin_ctzll(remaining);
+			remaining &= remaining - 1ULL;
+			if (notif->pending_vcpu[vcpu] != 0ULL) {
+				vcpus[count++] = (uint16_t)vcpu;
+			}
+		}
+
+		if ((count != 0U) &&
+		    !notif_info_add_list(info, id, vcpus, count)) {
+			/* Report the remaining vCPUs next time. */
+			notif_atomic_or(&notif->info_vcpu, mask);
+			return;
+		}
+		mask = remaining;
+	}
+}
+
+static uint64_t notif_info_get(uint32_t smc_fid, bool secure_origin,
+			       void *handle)
+{
+	struct secure_partition_desc *sp;
+	struct notif_info info;
+	bool smc64 = (smc_fid == FFA_NOTIFICATION_INFO_GET_SMC64);
+	unsigned int per_reg = smc64 ? 4U : 2U;
+	u_register_t regs[5] = { 0 };
+	unsigned int i;
+
+	if (secure_origin) {
+		return spmc_ffa_error_return(handle, FFA_ERROR_NOT_SUPPORTED);
+	}
+
+	(void)memset(&info, 0, sizeof(info));
+	info.max_ids = smc64 ? FFA_NOTIF_INFO_MAX_IDS_64 :
+			       FFA_NOTIF_INFO_MAX_IDS_32;
+	info.max_lists = smc64 ? FFA_NOTIF_INFO_MAX_LISTS_64 :
+				 FFA_NOTIF_INFO_MAX_LISTS_32;
+
+	for (i = 0U; i < SECURE_PARTITION_COUNT; i++) {
+		sp = spmc_get_sp_desc(i);
+		if (sp->sp_id != INV_SP_ID) {
+			notif_info_add(&info, sp->sp_id, &sp->notif);
+		}
+	}
+
+	spin_lock(&vm_notif_lock);
+	for (i = 0U; i < NS_PARTITION_COUNT; i++) {
+		if (vm_notif[i].created) {
+			notif_info_add(&info, vm_notif[i].vm_id,
+				       &vm_notif[i].notif);
+		}
+	}
+	spin_unlock(&vm_notif_lock);
+
+	if (info.list_count == 0U) {
+		return spmc_ffa_error_return(handle, FFA_ERROR_NO_DATA);
+	}
+
+	info.flags |= (uint64_t)info.list_count <<
+		      FFA_NOTIF_INFO_LIST_COUNT_SHIFT;
+
+	/* Pack the IDs, 16 bits each, in w3-w7 or x3-x7. */
+	for (i = 0U; i < info.id_count; i++) {
+		regs[i / per_reg] |= (u_register_t)info.ids[i] <<
+				     (16U * (i % per_reg));
+	}
+
+	SMC_RET8(handle, smc64 ? FFA_SUCCESS_SMC64 : FFA_SUCCESS_SMC32, 0,
+		 info.flags, regs[0], regs[1], regs[2], regs[3], regs[4]);
+}
+
+/*******************************************************************************
+ * Handler for the FFA_NOTIFICATION_* ABIs.
+ ******************************************************************************/
+uint64_t spmc_ffa_notification_handler(uint32_t smc_fid,
+				       bool secure_origin,
+				       uint64_t x1,
+				       uint64_t x2,
+				       uint64_t x3,
+				       uint64_t x4,
+				       void *cookie,
+				       void *handle,
+				       uint64_t flags)
+{
+	switch (smc_fid) {
+	case FFA_NOTIFICATION_BITMAP_CREATE:
+		return notif_bitmap_create(secure_origin, x1, x2, handle);
+
+	case FFA_NOTIFICATION_BITMAP_DESTROY:
+		return notif_bitmap_destroy(secure_origin, x1, handle);
+
+	case FFA_NOTIFICATION_BIND:
+	case FFA_NOTIFICATION_UNBIND:
+		return notif_bind(smc_fid, secure_origin, x1, x2, x3, x4,
+				  handle);
+
+	case FFA_NOTIFICATION_SET:
+		return notif_set(secure_origin, x1, x2, x3, x4, handle);
+
+	case FFA_NOTIFICATION_GET:
+		return notif_get(secure_origin, x1, x2, handle);
+
+	case FFA_NOTIFICATION_INFO_GET:
+	case FFA_NOTIFICATION_INFO_GET_SMC64:
+		return notif_info_get(smc_fid, secure_origin, handle);
+
+	default:
+		break;
+	}
+
+	return spmc_ffa_error_return(handle, FFA_ERROR_NOT_SUPPORTED);
+}
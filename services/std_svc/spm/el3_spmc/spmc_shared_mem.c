@@ -538,165 +538,118 @@ spmc_shm_convert_shmem_obj_from_v1_0(struct spmc_shmem_obj *out_obj,
 }
 
 /**
- * spmc_shm_convert_mtd_to_v1_0 - Converts a given v1.1 memory object to
- *                                v1.0 memory object.
- * @out_obj:    The shared memory object to populate the v1.0 descriptor.
- * @orig:       The shared memory object containing the v1.1 descriptor.
+ * spmc_populate_ffa_v1_0_descriptor - Populates the provided buffer with part
+ *                                     of the v1.0 form of a given v1.1 memory
+ *                                     object.
+ * @dst:	    Buffer to populate v1.0 ffa_memory_region_descriptor.
+ * @orig_obj:	    Object containing v1.1 ffa_memory_region_descriptor.
+ * @buf_size:	    Size of the buffer to populate.
+ * @offset:	    The offset of the converted descriptor to copy.
+ * @copy_size:	    Will be populated with the number of bytes copied.
+ * @out_desc_size:  Will be populated with the total size of the v1.0
+ *                  descriptor.
  *
- * Return: true if the conversion is successful else false.
+ * The v1.0 descriptor is never built in full. The header and the emad
+ * descriptors that fall within the requested range are generated one at a
+ * time, and the composite and constituent memory region descriptors, which
+ * have the same layout in both versions, are copied straight from @orig_obj.
+ * Each fragment is therefore copied once, and no space is needed in the
+ * datastore.
+ *
+ * Return: 0 if conversion and population succeeded.
  */
-static bool
-spmc_shm_convert_mtd_to_v1_0(struct spmc_shmem_obj *out_obj,
-			     struct spmc_shmem_obj *orig)
+static uint32_t
+spmc_populate_ffa_v1_0_descriptor(void *dst, struct spmc_shmem_obj *orig_obj,
+				 size_t buf_size, size_t offset,
+				 size_t *copy_size, size_t *v1_0_desc_size)
 {
-	struct ffa_mtd *mtd_orig = &orig->desc;
-	struct ffa_mtd_v1_0 *out = (struct ffa_mtd_v1_0 *) &out_obj->desc;
-	struct ffa_emad_v1_0 *emad_in;
-	struct ffa_emad_v1_0 *emad_array_in;
-	struct ffa_emad_v1_0 *emad_array_out;
-	struct ffa_comp_mrd *mrd_in;
-	struct ffa_comp_mrd *mrd_out;
-
+	struct ffa_mtd *mtd_orig = &orig_obj->desc;
+	struct ffa_mtd_v1_0 mtd_out;
+	struct ffa_emad_v1_0 emad_out;
+	uint8_t *out = dst;
 	size_t mrd_in_offset;
 	size_t mrd_out_offset;
-	size_t emad_out_array_size;
-	size_t mrd_size = 0;
-	size_t orig_desc_size = orig->desc_size;
-
-	/* Populate the v1.0 descriptor format from the v1.1 struct. */
-	out->sender_id = mtd_orig->sender_id;
-	out->memory_region_attributes = mtd_orig->memory_region_attributes;
-	out->flags = mtd_orig->flags;
-	out->handle = mtd_orig->handle;
-	out->tag = mtd_orig->tag;
-	out->emad_count = mtd_orig->emad_count;
-
-	/* Determine the location of the emad array in both descriptors. */
-	emad_array_in = (struct ffa_emad_v1_0 *)
-			((uint8_t *) mtd_orig + mtd_orig->emad_offset);
-	emad_array_out = out->emad;
+	size_t emad_start;
+	size_t pos = offset;
+	size_t end;
+	size_t len;
+	size_t i;
 
-	/* Copy across the emad structs. */
-	emad_in = emad_array_in;
-	for (unsigned int i = 0U; i < out->emad_count; i++) {
-		/* Bound check for emad array. */
-		if (((uint8_t *)emad_in + sizeof(struct ffa_emad_v1_0)) >
-				((uint8_t *) mtd_orig + orig_desc_size)) {
-			VERBOSE("%s: Invalid mtd structure.\n", __func__);
-			return false;
-		}
-		memcpy(&emad_array_out[i], emad_in,
-		       sizeof(struct ffa_emad_v1_0));
-
-		emad_in +=  mtd_orig->emad_size;
+	/* Calculate the size that the v1.0 descriptor will require. */
+	*v1_0_desc_size = spmc_shm_get_v1_0_descriptor_size(mtd_orig,
+							    orig_obj->desc_size);
+	if (*v1_0_desc_size == 0) {
+		ERROR("%s: cannot determine size of descriptor.\n", __func__);
+		return FFA_ERROR_INVALID_PARAMETER;
 	}
 
-	/* Place the mrd descriptors after the end of the emad descriptors. */
-	emad_out_array_size = sizeof(struct ffa_emad_v1_0) * out->emad_count;
-
-	mrd_out_offset =  (uint8_t *) out->emad - (uint8_t *) out +
-			  emad_out_array_size;
-
-	mrd_out = (struct ffa_comp_mrd *) ((uint8_t *) out + mrd_out_offset);
+	if (offset >= *v1_0_desc_size) {
+		return FFA_ERROR_INVALID_PARAMETER;
+	}
 
+	/* The mrd descriptors directly follow the emad descriptors. */
 	mrd_in_offset = mtd_orig->emad_offset +
 			(mtd_orig->emad_size * mtd_orig->emad_count);
+	mrd_out_offset = sizeof(struct ffa_mtd_v1_0) +
+			 (sizeof(struct ffa_emad_v1_0) * mtd_orig->emad_count);
 
-	/* Add the size of the composite memory region descriptor. */
-	mrd_size += sizeof(struct ffa_comp_mrd);
+	/* Verify that we stay within bound of the memory descriptor. */
+	if ((mtd_orig->emad_size < sizeof(struct ffa_emad_v1_0)) ||
+	    ((mrd_in_offset + *v1_0_desc_size - mrd_out_offset) >
+	     orig_obj->desc_size)) {
+		ERROR("%s: Invalid mtd structure.\n", __func__);
+		return FFA_ERROR_INVALID_PARAMETER;
+	}
 
-	/* Find the mrd descriptor. */
-	mrd_in = (struct ffa_comp_mrd *) ((uint8_t *) mtd_orig + mrd_in_offset);
+	end = offset + MIN(*v1_0_desc_size - offset, buf_size);
 
-	/* Add the size of the constituent memory region descriptors. */
-	mrd_size += mrd_in->address_range_count * sizeof(struct ffa_cons_mrd);
+	/* Populate the v1.0 header from the v1.1 struct. */
+	if (pos < sizeof(struct ffa_mtd_v1_0)) {
+		memset(&mtd_out, 0, sizeof(mtd_out));
+		mtd_out.sender_id = mtd_orig->sender_id;
+		mtd_out.memory_region_attributes =
+			mtd_orig->memory_region_attributes;
+		mtd_out.flags = mtd_orig->flags;
+		mtd_out.handle = mtd_orig->handle;
+		mtd_out.tag = mtd_orig->tag;
+		mtd_out.emad_count = mtd_orig->emad_count;
+
+		len = MIN(sizeof(struct ffa_mtd_v1_0), end) - pos;
+		memcpy(out, (uint8_t *) &mtd_out + pos, len);
+		out += len;
+		pos += len;
+	}
 
 	/*
-	 * Update the offset in the emads by the delta between the input and
-	 * output addresses.
+	 * Copy across the emad structs in range, updating the offset of the
+	 * mrd descriptor by the delta between the input and output layouts.
 	 */
-	emad_in = emad_array_in;
+	while (pos < MIN(mrd_out_offset, end)) {
+		i = (pos - sizeof(struct ffa_mtd_v1_0)) /
+		    sizeof(struct ffa_emad_v1_0);
+		emad_start = sizeof(struct ffa_mtd_v1_0) +
+			     (i * sizeof(struct ffa_emad_v1_0));
 
-	for (unsigned int i = 0U; i < out->emad_count; i++) {
-		emad_array_out[i].comp_mrd_offset = emad_in->comp_mrd_offset +
-						    (mrd_out_offset -
-						     mrd_in_offset);
-		emad_in +=  mtd_orig->emad_size;
-	}
+		memcpy(&emad_out, (uint8_t *) mtd_orig + mtd_orig->emad_offset +
+		       (i * mtd_orig->emad_size), sizeof(emad_out));
+		emad_out.comp_mrd_offset += mrd_out_offset - mrd_in_offset;
 
-	/* Verify that we stay within bound of the memory descriptors. */
-	if ((uintptr_t)((uint8_t *) mrd_in + mrd_size) >
-	     (uintptr_t)((uint8_t *) mtd_orig + orig->desc_size) ||
-	    ((uintptr_t)((uint8_t *) mrd_out + mrd_size) >
-	     (uintptr_t)((uint8_t *) out + out_obj->desc_size))) {
-		ERROR("%s: Invalid mrd structure.\n", __func__);
-		return false;
+		len = MIN(emad_start + sizeof(emad_out), end) - pos;
+		memcpy(out, (uint8_t *) &emad_out + (pos - emad_start), len);
+		out += len;
+		pos += len;
 	}
 
 	/* Copy the mrd descriptors directly. */
-	memcpy(mrd_out, mrd_in, mrd_size);
-
-	return true;
-}
-
-/**
- * spmc_populate_ffa_v1_0_descriptor - Converts a given v1.1 memory object to
- *                                     the v1.0 format and populates the
- *                                     provided buffer.
- * @dst:	    Buffer to populate v1.0 ffa_memory_region_descriptor.
- * @orig_obj:	    Object containing v1.1 ffa_memory_region_descriptor.
- * @buf_size:	    Size of the buffer to populate.
- * @offset:	    The offset of the converted descriptor to copy.
- * @copy_size:	    Will be populated with the number of bytes copied.
- * @out_desc_size:  Will be populated with the total size of the v1.0
- *                  descriptor.
- *
- * Return: 0 if conversion and population succeeded.
- * Note: This function invalidates the reference to @orig therefore
- * `spmc_shmem_obj_lookup` must be called if further usage is required.
- */
-static uint32_t
-spmc_populate_ffa_v1_0_descriptor(void *dst, struct spmc_shmem_obj *orig_obj,
-				 size_t buf_size, size_t offset,
-				 size_t *copy_size, size_t *v1_0_desc_size)
-{
-		struct spmc_shmem_obj *v1_0_obj;
-
-		/* Calculate the size that the v1.0 descriptor will require. */
-		*v1_0_desc_size = spmc_shm_get_v1_0_descriptor_size(
-					&orig_obj->desc, orig_obj->desc_size);
-
-		if (*v1_0_desc_size == 0) {
-			ERROR("%s: cannot determine size of descriptor.\n",
-			      __func__);
-			return FFA_ERROR_INVALID_PARAMETER;
-		}
-
-		/* Get a new obj to store the v1.0 descriptor. */
-		v1_0_obj = spmc_shmem_obj_alloc(&spmc_shmem_obj_state,
-						*v1_0_desc_size);
-
-		if (!v1_0_obj) {
-			return FFA_ERROR_NO_MEMORY;
-		}
-
-		/* Perform the conversion from v1.1 to v1.0. */
-		if (!spmc_shm_convert_mtd_to_v1_0(v1_0_obj, orig_obj)) {
-			spmc_shmem_obj_free(&spmc_shmem_obj_state, v1_0_obj);
-			return FFA_ERROR_INVALID_PARAMETER;
-		}
-
-		*copy_size = MIN(v1_0_obj->desc_size - offset, buf_size);
-		memcpy(dst, (uint8_t *) &v1_0_obj->desc + offset, *copy_size);
+	if (pos < end) {
+		memcpy(out, (uint8_t *) mtd_orig + mrd_in_offset +
+		       (pos - mrd_out_offset), end - pos);
+		pos = end;
+	}
 
-		/*
-		 * We're finished with the v1.0 descriptor for now so free it.
-		 * Note that this will invalidate any references to the v1.1
-		 * descriptor.
-		 */
-		spmc_shmem_obj_free(&spmc_shmem_obj_state, v1_0_obj);
+	*copy_size = pos - offset;
 
-		return 0;
+	return 0;
 }
 
 /**
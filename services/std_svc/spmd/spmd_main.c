@@ -97,6 +97,14 @@ static uint64_t spmd_smc_forward(uint32_t smc_fid,
 				 void *cookie,
 				 void *handle,
 				 uint64_t flags);
+static uintptr_t spmd_ffa_direct_msg_fast_handler(uint32_t smc_fid,
+						  u_register_t x1,
+						  u_register_t x2,
+						  u_register_t x3,
+						  u_register_t x4,
+						  void *cookie,
+						  void *handle,
+						  u_register_t flags);
 
 /******************************************************************************
  * Builds an SPMD to SPMC direct message request.
@@ -573,6 +581,22 @@ static int spmd_spmc_init(void *pm_addr)
 	return 0;
 }
 
+/*******************************************************************************
+ * Route FF-A direct messages straight to their handler. Only done once the SPM
+ * Core has been initialised, so that they otherwise take the normal path.
+ ******************************************************************************/
+static void spmd_register_fast_fids(void)
+{
+	(void)rt_svc_register_fast_fid(FFA_MSG_SEND_DIRECT_REQ_SMC32,
+				       spmd_ffa_direct_msg_fast_handler);
+	(void)rt_svc_register_fast_fid(FFA_MSG_SEND_DIRECT_REQ_SMC64,
+				       spmd_ffa_direct_msg_fast_handler);
+	(void)rt_svc_register_fast_fid(FFA_MSG_SEND_DIRECT_RESP_SMC32,
+				       spmd_ffa_direct_msg_fast_handler);
+	(void)rt_svc_register_fast_fid(FFA_MSG_SEND_DIRECT_RESP_SMC64,
+				       spmd_ffa_direct_msg_fast_handler);
+}
+
 /*******************************************************************************
  * Initialize context of SPM Core.
  ******************************************************************************/
@@ -592,6 +616,8 @@ int spmd_setup(void)
 		rc = spmc_setup();
 		if (rc != 0) {
 			WARN("SPMC initialisation failed 0x%x.\n", rc);
+		} else {
+			spmd_register_fast_fids();
 		}
 		return 0;
 	}
@@ -619,6 +645,8 @@ int spmd_setup(void)
 	rc = spmd_spmc_init(spmc_manifest);
 	if (rc != 0) {
 		WARN("Booting device without SPM initialization.\n");
+	} else {
+		spmd_register_fast_fids();
 	}
 
 	return 0;
@@ -637,11 +665,30 @@ uint64_t spmd_smc_switch_state(uint32_t smc_fid,
 {
 	unsigned int secure_state_in = (secure_origin) ? SECURE : NON_SECURE;
 	unsigned int secure_state_out = (!secure_origin) ? SECURE : NON_SECURE;
+#if SPMD_FAST_DIRECT_MSG
+	spmd_spm_core_context_t *ctx = spmd_get_context();
+#endif
 
 	/* Save incoming security state */
 #if SPMD_SPM_AT_SEL2
 	if (secure_state_in == NON_SECURE) {
+#if SPMD_FAST_DIRECT_MSG
+		/*
+		 * An SPMC which preserves the EL1 context across direct
+		 * messages leaves the Non-secure EL1 registers untouched, so
+		 * there is no need to save them. Only the GP registers and the
+		 * EL2 context are switched.
+		 */
+		if ((spmc_attrs.el1_ctx_preserved != 0U) &&
+		    ((smc_fid == FFA_MSG_SEND_DIRECT_REQ_SMC32) ||
+		     (smc_fid == FFA_MSG_SEND_DIRECT_REQ_SMC64))) {
+			ctx->ns_el1_ctx_live = true;
+		} else {
+			cm_el1_sysregs_context_save(secure_state_in);
+		}
+#else
 		cm_el1_sysregs_context_save(secure_state_in);
+#endif
 	}
 	cm_el2_sysregs_context_save(secure_state_in);
 #else
@@ -651,7 +698,16 @@ uint64_t spmd_smc_switch_state(uint32_t smc_fid,
 	/* Restore outgoing security state */
 #if SPMD_SPM_AT_SEL2
 	if (secure_state_out == NON_SECURE) {
+#if SPMD_FAST_DIRECT_MSG
+		/* The hardware still holds the Non-secure EL1 context */
+		if (ctx->ns_el1_ctx_live) {
+			ctx->ns_el1_ctx_live = false;
+		} else {
+			cm_el1_sysregs_context_restore(secure_state_out);
+		}
+#else
 		cm_el1_sysregs_context_restore(secure_state_out);
+#endif
 	}
 	cm_el2_sysregs_context_restore(secure_state_out);
 #else
@@ -765,6 +821,96 @@ static int spmd_handle_spmc_message(unsigned long long msg,
 	return -EINVAL;
 }
 
+/*******************************************************************************
+ * This function handles FF-A direct message requests and responses, either by
+ * consuming SPMC to SPMD messages or by forwarding them to the other world.
+ ******************************************************************************/
+static uint64_t spmd_ffa_direct_msg_handler(uint32_t smc_fid,
+					    bool secure_origin,
+					    uint64_t x1,
+					    uint64_t x2,
+					    uint64_t x3,
+					    uint64_t x4,
+					    void *cookie,
+					    void *handle,
+					    uint64_t flags)
+{
+	int32_t ret;
+
+	switch (smc_fid) {
+	case FFA_MSG_SEND_DIRECT_REQ_SMC32:
+	case FFA_MSG_SEND_DIRECT_REQ_SMC64:
+		if (!secure_origin) {
+			/* Validate source endpoint is non-secure for non-secure caller. */
+			if (ffa_is_secure_world_id(ffa_endpoint_source(x1))) {
+				return spmd_ffa_error_return(handle,
+						FFA_ERROR_INVALID_PARAMETER);
+			}
+		}
+		if (secure_origin && spmd_is_spmc_message(x1)) {
+			ret = spmd_handle_spmc_message(x3, x4,
+				SMC_GET_GP(handle, CTX_GPREG_X5),
+				SMC_GET_GP(handle, CTX_GPREG_X6),
+				SMC_GET_GP(handle, CTX_GPREG_X7));
+
+			SMC_RET8(handle, FFA_SUCCESS_SMC32,
+				FFA_TARGET_INFO_MBZ, ret,
+				FFA_PARAM_MBZ, FFA_PARAM_MBZ,
+				FFA_PARAM_MBZ, FFA_PARAM_MBZ,
+				FFA_PARAM_MBZ);
+		}
+		break;
+
+	case FFA_MSG_SEND_DIRECT_RESP_SMC32:
+		if (secure_origin && spmd_is_spmc_message(x1)) {
+			spmd_spm_core_sync_exit(0ULL);
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	/* Forward direct message to the other world */
+	return spmd_smc_forward(smc_fid, secure_origin,
+				x1, x2, x3, x4, cookie,
+				handle, flags);
+}
+
+/*******************************************************************************
+ * Handler for the FF-A direct message function IDs registered for fast
+ * dispatch. It goes through the same checks as the Standard Service and the
+ * SPMD top level handlers without the function ID decoding.
+ ******************************************************************************/
+static uintptr_t spmd_ffa_direct_msg_fast_handler(uint32_t smc_fid,
+						  u_register_t x1,
+						  u_register_t x2,
+						  u_register_t x3,
+						  u_register_t x4,
+						  void *cookie,
+						  void *handle,
+						  u_register_t flags)
+{
+	bool secure_origin = is_caller_secure(flags);
+
+	if (((smc_fid >> FUNCID_CC_SHIFT) & FUNCID_CC_MASK) == SMC_32) {
+		/* 32-bit SMC function, clear top parameter bits */
+		x1 &= UINT32_MAX;
+		x2 &= UINT32_MAX;
+		x3 &= UINT32_MAX;
+		x4 &= UINT32_MAX;
+	}
+
+	if (is_spmc_at_el3() && secure_origin) {
+		return spmc_smc_handler(smc_fid, secure_origin, x1, x2, x3, x4,
+					cookie, handle, flags);
+	}
+
+	return spmd_ffa_direct_msg_handler(smc_fid, secure_origin,
+					   x1, x2, x3, x4, cookie,
+					   handle, flags);
+}
+
 /*******************************************************************************
  * This function forwards FF-A SMCs to either the main SPMD handler or the
  * SPMC at EL3, depending on the origin security state, if enabled.
@@ -1023,41 +1169,10 @@ uint64_t spmd_smc_handler(uint32_t smc_fid,
 
 	case FFA_MSG_SEND_DIRECT_REQ_SMC32:
 	case FFA_MSG_SEND_DIRECT_REQ_SMC64:
-		if (!secure_origin) {
-			/* Validate source endpoint is non-secure for non-secure caller. */
-			if (ffa_is_secure_world_id(ffa_endpoint_source(x1))) {
-				return spmd_ffa_error_return(handle,
-						FFA_ERROR_INVALID_PARAMETER);
-			}
-		}
-		if (secure_origin && spmd_is_spmc_message(x1)) {
-			ret = spmd_handle_spmc_message(x3, x4,
-				SMC_GET_GP(handle, CTX_GPREG_X5),
-				SMC_GET_GP(handle, CTX_GPREG_X6),
-				SMC_GET_GP(handle, CTX_GPREG_X7));
-
-			SMC_RET8(handle, FFA_SUCCESS_SMC32,
-				FFA_TARGET_INFO_MBZ, ret,
-				FFA_PARAM_MBZ, FFA_PARAM_MBZ,
-				FFA_PARAM_MBZ, FFA_PARAM_MBZ,
-				FFA_PARAM_MBZ);
-		} else {
-			/* Forward direct message to the other world */
-			return spmd_smc_forward(smc_fid, secure_origin,
-						x1, x2, x3, x4, cookie,
-						handle, flags);
-		}
-		break; /* Not reached */
-
 	case FFA_MSG_SEND_DIRECT_RESP_SMC32:
-		if (secure_origin && spmd_is_spmc_message(x1)) {
-			spmd_spm_core_sync_exit(0ULL);
-		} else {
-			/* Forward direct message to the other world */
-			return spmd_smc_forward(smc_fid, secure_origin,
-						x1, x2, x3, x4, cookie,
-						handle, flags);
-		}
+		return spmd_ffa_direct_msg_handler(smc_fid, secure_origin,
+						   x1, x2, x3, x4, cookie,
+						   handle, flags);
 		break; /* Not reached */
 
 	case FFA_RX_RELEASE:
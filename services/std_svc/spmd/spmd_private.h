@@ -52,6 +52,14 @@ typedef struct spmd_spm_core_context {
 	cpu_context_t cpu_ctx;
 	spmc_state_t state;
 	bool secure_interrupt_ongoing;
+#if SPMD_FAST_DIRECT_MSG
+	/*
+	 * The Non-secure EL1 system registers were left in place when
+	 * forwarding a direct message request to the SPMC, so the copy in the
+	 * Non-secure context is stale and must not be restored.
+	 */
+	bool ns_el1_ctx_live;
+#endif
 } spmd_spm_core_context_t;
 
 /*
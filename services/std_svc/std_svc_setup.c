@@ -35,6 +35,53 @@ static uuid_t arm_svc_uid = {
 	{0xc0, 0xfb, 0x56, 0x41, 0xf6, 0xe2}
 };
 
+/*
+ * Dispatch a PSCI call to the PSCI SMC handler. This is also the handler that
+ * hot PSCI function IDs are routed to by the fast SMC dispatch path, so it
+ * does its own clearing of the top parameter bits for 32-bit calls.
+ */
+static uintptr_t std_svc_psci_handler(uint32_t smc_fid,
+				      u_register_t x1,
+				      u_register_t x2,
+				      u_register_t x3,
+				      u_register_t x4,
+				      void *cookie,
+				      void *handle,
+				      u_register_t flags)
+{
+	uint64_t ret;
+
+	if (((smc_fid >> FUNCID_CC_SHIFT) & FUNCID_CC_MASK) == SMC_32) {
+		x1 &= UINT32_MAX;
+		x2 &= UINT32_MAX;
+		x3 &= UINT32_MAX;
+		x4 &= UINT32_MAX;
+	}
+
+#if ENABLE_RUNTIME_INSTRUMENTATION
+
+	/*
+	 * Flush cache line so that even if CPU power down happens
+	 * the timestamp update is reflected in memory.
+	 */
+	PMF_WRITE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_ENTER_PSCI,
+	    PMF_CACHE_MAINT,
+	    get_cpu_data(cpu_data_pmf_ts[CPU_DATA_PMF_TS0_IDX]));
+#endif
+
+	ret = psci_smc_handler(smc_fid, x1, x2, x3, x4,
+	    cookie, handle, flags);
+
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_EXIT_PSCI,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
+	SMC_RET1(handle, ret);
+}
+
 /* Setup Standard Services */
 static int32_t std_svc_setup(void)
 {
@@ -50,6 +97,12 @@ static int32_t std_svc_setup(void)
 	 */
 	if (psci_setup((const psci_lib_args_t *)svc_arg) != PSCI_E_SUCCESS) {
 		ret = 1;
+	} else {
+		/* CPU_SUSPEND is issued on every idle entry, route it directly */
+		(void)rt_svc_register_fast_fid(PSCI_CPU_SUSPEND_AARCH32,
+					       std_svc_psci_handler);
+		(void)rt_svc_register_fast_fid(PSCI_CPU_SUSPEND_AARCH64,
+					       std_svc_psci_handler);
 	}
 
 #if SPM_MM
@@ -116,30 +169,8 @@ static uintptr_t std_svc_smc_handler(uint32_t smc_fid,
 	 * value
 	 */
 	if (is_psci_fid(smc_fid)) {
-		uint64_t ret;
-
-#if ENABLE_RUNTIME_INSTRUMENTATION
-
-		/*
-		 * Flush cache line so that even if CPU power down happens
-		 * the timestamp update is reflected in memory.
-		 */
-		PMF_WRITE_TIMESTAMP(rt_instr_svc,
-		    RT_INSTR_ENTER_PSCI,
-		    PMF_CACHE_MAINT,
-		    get_cpu_data(cpu_data_pmf_ts[CPU_DATA_PMF_TS0_IDX]));
-#endif
-
-		ret = psci_smc_handler(smc_fid, x1, x2, x3, x4,
-		    cookie, handle, flags);
-
-#if ENABLE_RUNTIME_INSTRUMENTATION
-		PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
-		    RT_INSTR_EXIT_PSCI,
-		    PMF_NO_CACHE_MAINT);
-#endif
-
-		SMC_RET1(handle, ret);
+		return std_svc_psci_handler(smc_fid, x1, x2, x3, x4, cookie,
+					    handle, flags);
 	}
 
 #if SPM_MM
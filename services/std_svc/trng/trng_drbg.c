@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * SiP service returning bulk random data from an NIST SP 800-90A CTR_DRBG
+ * (AES-256, with derivation function) seeded from the TRNG entropy pool. The
+ * data is written directly into a buffer provided by the Non-secure caller.
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <common/debug.h>
+#include <lib/spinlock.h>
+#include <lib/utils.h>
+#include <lib/xlat_tables/xlat_tables_v2.h>
+#include <mbedtls/ctr_drbg.h>
+#include <plat/common/plat_trng.h>
+#include <plat/common/platform.h>
+#include <services/trng_drbg.h>
+#include <services/trng_svc.h>
+#include <smccc_helpers.h>
+
+#include "trng_entropy_pool.h"
+
+/* Maximum number of bytes returned by one TRNG_DRBG_SMC_GENERATE call */
+#ifdef PLAT_TRNG_DRBG_MAX_BYTES
+#define TRNG_DRBG_MAX_BYTES		PLAT_TRNG_DRBG_MAX_BYTES
+#else
+#define TRNG_DRBG_MAX_BYTES		U(0x4000)
+#endif
+
+/*
+ * Number of DRBG requests, of up to MBEDTLS_CTR_DRBG_MAX_REQUEST bytes each,
+ * between two reseeds from the TRNG entropy pool.
+ */
+#ifdef PLAT_TRNG_DRBG_RESEED_INTERVAL
+#define TRNG_DRBG_RESEED_INTERVAL	PLAT_TRNG_DRBG_RESEED_INTERVAL
+#else
+#define TRNG_DRBG_RESEED_INTERVAL	1024
+#endif
+
+#define TRNG_DRBG_ENTROPY_WORDS		(TRNG_RND64_ENTROPY_MAXBITS / 64U)
+
+/*
+ * One DRBG instance per CPU, seeded on its first use, with a buffer to generate
+ * one request into before it is copied to the Non-secure caller. The SMC
+ * handler runs with interrupts masked, so an instance is only used by one call
+ * at a time.
+ */
+typedef struct trng_drbg {
+	mbedtls_ctr_drbg_context ctx;
+	bool seeded;
+	unsigned char buf[MBEDTLS_CTR_DRBG_MAX_REQUEST];
+} trng_drbg_t;
+
+static trng_drbg_t trng_drbg[PLATFORM_CORE_COUNT];
+
+/* Entropy callback of the DRBG, fed from the entropy pool of this CPU */
+static int trng_drbg_entropy(void *data, unsigned char *buf, size_t len)
+{
+	uint64_t ent[TRNG_DRBG_ENTROPY_WORDS];
+	size_t n;
+	int ret = 0;
+
+	while (len > 0U) {
+		n = MIN(len, sizeof(ent));
+
+		/* trng_pack_entropy() ORs the entropy into its output */
+		zeromem(ent, sizeof(ent));
+		if (!trng_pack_entropy((uint32_t)n * 8U, ent)) {
+			ret = MBEDTLS_ERR_CTR_DRBG_ENTROPY_SOURCE_FAILED;
+			break;
+		}
+
+		(void)memcpy(buf, ent, n);
+		buf += n;
+		len -= n;
+	}
+
+	zeromem(ent, sizeof(ent));
+
+	return ret;
+}
+
+static int trng_drbg_seed(trng_drbg_t *drbg, unsigned int core_pos)
+{
+	/* Personalisation string, unique to each instance */
+	const unsigned char pers[] = {
+		'T', 'F', '-', 'A', ' ', 'D', 'R', 'B', 'G', (unsigned char)core_pos
+	};
+	int ret;
+
+	mbedtls_ctr_drbg_init(&drbg->ctx);
+
+	ret = mbedtls_ctr_drbg_seed(&drbg->ctx, trng_drbg_entropy, NULL, pers,
+				    sizeof(pers));
+	if (ret != 0) {
+		mbedtls_ctr_drbg_free(&drbg->ctx);
+		return ret;
+	}
+
+	mbedtls_ctr_drbg_set_reseed_interval(&drbg->ctx,
+					     TRNG_DRBG_RESEED_INTERVAL);
+	drbg->seeded = true;
+
+	return 0;
+}
+
+/*
+ * Write 'size' bytes from 'src', or zeroes if 'src' is NULL, to the Non-secure
+ * buffer at physical address 'base'. The pages holding the range are mapped for
+ * the duration of the copy only.
+ *
+ * The dynamic regions of the EL3 translation context are shared by all CPUs,
+ * so the mapping, copy and unmapping are serialised with the lock of the
+ * dynamic regions. This bounds the number of regions and translation tables
+ * used by the service to those needed for one range.
+ */
+static int trng_drbg_write_ns(uintptr_t base, const void *src, size_t size)
+{
+	uintptr_t map_base, va;
+	size_t map_size;
+	int ret;
+
+	map_base = round_down(base, PAGE_SIZE);
+	map_size = round_up(base + size, PAGE_SIZE) - map_base;
+
+	spin_lock(&mmap_dynamic_region_lock);
+
+	ret = mmap_add_dynamic_region_alloc_va(map_base, &va, map_size,
+					       MT_MEMORY | MT_NS | MT_RW |
+					       MT_EXECUTE_NEVER |
+					       MT_SHAREABILITY_ISH);
+	if (ret != 0) {
+		spin_unlock(&mmap_dynamic_region_lock);
+		WARN("TRNG DRBG: failed to map buffer 0x%lx (%d)\n",
+		     base, ret);
+		return ret;
+	}
+
+	if (src != NULL) {
+		(void)memcpy((void *)(va + (base - map_base)), src, size);
+	} else {
+		zeromem((void *)(va + (base - map_base)), size);
+	}
+
+	if (mmap_remove_dynamic_region(va, map_size) != 0) {
+		ERROR("TRNG DRBG: failed to unmap buffer 0x%lx\n", base);
+		panic();
+	}
+
+	spin_unlock(&mmap_dynamic_region_lock);
+
+	return 0;
+}
+
+/*
+ * Generate 'size' bytes of random data into the Non-secure buffer at physical
+ * address 'base'. Each DRBG request is generated into the buffer of this CPU
+ * without any lock held, then copied to the caller. The lock of the dynamic
+ * regions is thus only held for the copy of at most one request.
+ */
+static int trng_drbg_generate_ns(uintptr_t base, size_t size)
+{
+	unsigned int core_pos = plat_my_core_pos();
+	trng_drbg_t *drbg = &trng_drbg[core_pos];
+	size_t done, n;
+	int ret = TRNG_DRBG_E_SUCCESS;
+
+	if ((size == 0U) || (size > TRNG_DRBG_MAX_BYTES) ||
+	    (base > (UINTPTR_MAX - size - PAGE_SIZE))) {
+		return TRNG_DRBG_E_INVALID_PARAMS;
+	}
+
+	if (plat_trng_drbg_validate_ns_buffer(round_down(base, PAGE_SIZE),
+			round_up(base + size, PAGE_SIZE) -
+			round_down(base, PAGE_SIZE)) != 0) {
+		return TRNG_DRBG_E_INVALID_PARAMS;
+	}
+
+	if (!drbg->seeded && (trng_drbg_seed(drbg, core_pos) != 0)) {
+		return TRNG_DRBG_E_NO_ENTROPY;
+	}
+
+	for (done = 0U; done < size; done += n) {
+		n = MIN(size - done, sizeof(drbg->buf));
+
+		if (mbedtls_ctr_drbg_random(&drbg->ctx, drbg->buf, n) != 0) {
+			ret = TRNG_DRBG_E_NO_ENTROPY;
+			break;
+		}
+
+		if (trng_drbg_write_ns(base + done, drbg->buf, n) != 0) {
+			ret = TRNG_DRBG_E_DENIED;
+			break;
+		}
+	}
+
+	zeromem(drbg->buf, sizeof(drbg->buf));
+
+	/*
+	 * Do not leave partial output in the buffer. It is cleared request by
+	 * request, as it was written, so the mappings cannot fail.
+	 */
+	if (ret != TRNG_DRBG_E_SUCCESS) {
+		while (done > 0U) {
+			n = ((done - 1U) % sizeof(drbg->buf)) + 1U;
+			done -= n;
+			if (trng_drbg_write_ns(base + done, NULL, n) != 0) {
+				ERROR("TRNG DRBG: failed to clear buffer 0x%lx\n",
+				      base);
+				panic();
+			}
+		}
+	}
+
+	return ret;
+}
+
+/*
+ * This function is responsible for handling all TRNG DRBG SMC calls from the
+ * Non-secure world.
+ */
+uintptr_t trng_drbg_smc_handler(unsigned int smc_fid,
+				u_register_t x1,
+				u_register_t x2,
+				u_register_t x3,
+				u_register_t x4,
+				void *cookie,
+				void *handle,
+				u_register_t flags)
+{
+	switch (smc_fid) {
+	case TRNG_DRBG_SMC_GET_INFO:
+		/*
+		 * x0 --> error code.
+		 * x1 --> maximum number of bytes returned by one call.
+		 * x2 --> maximum number of bytes generated between two
+		 *        reseeds of the DRBG of a CPU.
+		 */
+		SMC_RET3(handle, TRNG_DRBG_E_SUCCESS, TRNG_DRBG_MAX_BYTES,
+			 (u_register_t)TRNG_DRBG_RESEED_INTERVAL *
+			 MBEDTLS_CTR_DRBG_MAX_REQUEST);
+
+	case TRNG_DRBG_SMC_GENERATE:
+		/*
+		 * x1 <-- physical address of the Non-secure buffer.
+		 * x2 <-- number of bytes to generate.
+		 * x0 --> error code.
+		 */
+		SMC_RET1(handle, trng_drbg_generate_ns(x1, x2));
+
+	default:
+		break;
+	}
+
+	SMC_RET1(handle, SMC_UNK);
+}
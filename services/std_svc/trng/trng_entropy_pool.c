@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, ARM Limited. All rights reserved.
+ * Copyright (c) 2021-2026, ARM Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -7,74 +7,122 @@
 #include <assert.h>
 #include <stdbool.h>
 #include <stdint.h>
+
+#include <common/debug.h>
 #include <lib/spinlock.h>
+#include <lib/utils.h>
 #include <plat/common/plat_trng.h>
+#include <plat/common/platform.h>
+
+#include <platform_def.h>
 
 /*
- * # Entropy pool
- * Note that the TRNG Firmware interface can request up to 192 bits of entropy
- * in a single call or three 64bit words per call. We have 4 words in the pool
- * so that when we have 1-63 bits in the pool, and we have a request for
- * 192 bits of entropy, we don't have to throw out the leftover 1-63 bits of
- * entropy.
+ * # Entropy pools
+ * Each CPU packs entropy from its own pool, so that concurrent requests do not
+ * serialise. Note that the TRNG Firmware interface can request up to 192 bits
+ * of entropy in a single call or three 64bit words per call. We have 4 words
+ * in each pool so that when we have 1-63 bits in the pool, and we have a
+ * request for 192 bits of entropy, we don't have to throw out the leftover
+ * 1-63 bits of entropy.
+ *
+ * The per-CPU pools are refilled with whole words from a global reservoir of
+ * PLAT_TRNG_RESERVOIR_WORDS words, which is refilled from the platform entropy
+ * source, either synchronously when it runs dry or by
+ * trng_entropy_pool_refill().
  */
 #define WORDS_IN_POOL	(4)
-static uint64_t entropy[WORDS_IN_POOL];
-/* index in bits of the first bit of usable entropy */
-static uint32_t entropy_bit_index;
-/* then number of valid bits in the entropy pool */
-static uint32_t entropy_bit_size;
 
+typedef struct trng_pool {
+	uint64_t entropy[WORDS_IN_POOL];
+	/* index in bits of the first bit of usable entropy */
+	uint32_t bit_index;
+	/* then number of valid bits in the entropy pool */
+	uint32_t bit_size;
+} trng_pool_t;
+
+static trng_pool_t trng_pools[PLATFORM_CORE_COUNT];
+
+#ifndef PLAT_TRNG_RESERVOIR_WORDS
+#define PLAT_TRNG_RESERVOIR_WORDS	U(16)
+#endif
+
+static uint64_t trng_reservoir[PLAT_TRNG_RESERVOIR_WORDS];
+/* number of valid words at the start of the reservoir */
+static unsigned int trng_reservoir_words;
+
+/* Protects the reservoir and serialises calls to the entropy source */
 static spinlock_t trng_pool_lock;
 
-#define BITS_PER_WORD		(sizeof(entropy[0]) * 8)
+#define BITS_PER_WORD		(sizeof(uint64_t) * 8)
 #define BITS_IN_POOL		(WORDS_IN_POOL * BITS_PER_WORD)
-#define ENTROPY_MIN_WORD	(entropy_bit_index / BITS_PER_WORD)
-#define ENTROPY_FREE_BIT	(entropy_bit_size + entropy_bit_index)
+#define ENTROPY_MIN_WORD	(pool->bit_index / BITS_PER_WORD)
+#define ENTROPY_FREE_BIT	(pool->bit_size + pool->bit_index)
 #define _ENTROPY_FREE_WORD	(ENTROPY_FREE_BIT / BITS_PER_WORD)
 #define ENTROPY_FREE_INDEX	(_ENTROPY_FREE_WORD % WORDS_IN_POOL)
 /* ENTROPY_WORD_INDEX(0) includes leftover bits in the lower bits */
 #define ENTROPY_WORD_INDEX(i)	((ENTROPY_MIN_WORD + i) % WORDS_IN_POOL)
 
 /*
- * Fill the entropy pool until we have at least as many bits as requested.
+ * Take a word of entropy from the reservoir, or from the entropy source if the
+ * reservoir is empty and 'use_source' is set. Returns false if no entropy is
+ * available. Assumes trng_pool_lock is taken.
+ */
+static bool trng_reservoir_take(uint64_t *out, bool use_source)
+{
+	if (trng_reservoir_words != 0U) {
+		trng_reservoir_words--;
+		*out = trng_reservoir[trng_reservoir_words];
+		trng_reservoir[trng_reservoir_words] = 0ULL;
+		return true;
+	}
+
+	return use_source && plat_get_entropy(out);
+}
+
+/*
+ * Fill the entropy pool of this CPU until we have at least as many bits as
+ * requested. The pool is topped up with the words left in the reservoir, but
+ * the entropy source is only read for the missing bits.
  * Returns true after filling the pool, and false if the entropy source is out
  * of entropy and the pool could not be filled.
- * Assumes locks are taken.
  */
-static bool trng_fill_entropy(uint32_t nbits)
+static bool trng_fill_entropy(trng_pool_t *pool, uint32_t nbits)
 {
-	while (nbits > entropy_bit_size) {
-		bool valid = plat_get_entropy(&entropy[ENTROPY_FREE_INDEX]);
+	if (nbits <= pool->bit_size) {
+		return true;
+	}
 
-		if (valid) {
-			entropy_bit_size += BITS_PER_WORD;
-			assert(entropy_bit_size <= BITS_IN_POOL);
-		} else {
-			return false;
+	spin_lock(&trng_pool_lock);
+
+	while ((pool->bit_size + BITS_PER_WORD) <= BITS_IN_POOL) {
+		if (!trng_reservoir_take(&pool->entropy[ENTROPY_FREE_INDEX],
+					 nbits > pool->bit_size)) {
+			break;
 		}
+		pool->bit_size += BITS_PER_WORD;
 	}
-	return true;
+
+	spin_unlock(&trng_pool_lock);
+
+	return nbits <= pool->bit_size;
 }
 
 /*
- * Pack entropy into the out buffer, filling and taking locks as needed.
- * Returns true on success, false on failure.
+ * Pack entropy from the pool of this CPU into the out buffer, filling it as
+ * needed. Returns true on success, false on failure.
  *
  * Note: out must have enough space for nbits of entropy
  */
 bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 {
-	bool ret = true;
+	trng_pool_t *pool = &trng_pools[plat_my_core_pos()];
 	uint32_t bits_to_discard = nbits;
-	spin_lock(&trng_pool_lock);
 
-	if (!trng_fill_entropy(nbits)) {
-		ret = false;
-		goto out;
+	if (!trng_fill_entropy(pool, nbits)) {
+		return false;
 	}
 
-	const unsigned int rshift = entropy_bit_index % BITS_PER_WORD;
+	const unsigned int rshift = pool->bit_index % BITS_PER_WORD;
 	const unsigned int lshift = BITS_PER_WORD - rshift;
 	const int to_fill = ((nbits + BITS_PER_WORD - 1) / BITS_PER_WORD);
 	int word_i;
@@ -111,7 +159,8 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 		 *                   5 4 3 2 1 0 7 6
 		 *                  [e,e,e,e,e,e,e,e]
 		 */
-		out[word_i] |= entropy[ENTROPY_WORD_INDEX(word_i)] >> rshift;
+		out[word_i] |=
+			pool->entropy[ENTROPY_WORD_INDEX(word_i)] >> rshift;
 
 		/**
 		 * Discarding the used/packed entropy bits from the respective
@@ -156,7 +205,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 		 * amount of bits only.
 		 */
 		if (bits_to_discard < (BITS_PER_WORD - rshift)) {
-			entropy[ENTROPY_WORD_INDEX(word_i)] &=
+			pool->entropy[ENTROPY_WORD_INDEX(word_i)] &=
 			(~0ULL << ((bits_to_discard+rshift) % BITS_PER_WORD));
 			bits_to_discard = 0;
 		} else {
@@ -167,7 +216,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 		 * will be already zeros from previous operations, and the
 		 * bits_to_discard is updated precisely.
 		 */
-			entropy[ENTROPY_WORD_INDEX(word_i)] = 0;
+			pool->entropy[ENTROPY_WORD_INDEX(word_i)] = 0;
 			bits_to_discard -= (BITS_PER_WORD - rshift);
 		}
 
@@ -178,7 +227,8 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 		 * the `|=` operation.
 		 */
 		if (lshift != BITS_PER_WORD) {
-			out[word_i] |= entropy[ENTROPY_WORD_INDEX(word_i + 1)]
+			out[word_i] |=
+				pool->entropy[ENTROPY_WORD_INDEX(word_i + 1)]
 				<< lshift;
 			/**
 			 * Discarding the remaining packed bits from upperword
@@ -191,7 +241,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 			 * amount of bits only.
 			 */
 			if (bits_to_discard < (BITS_PER_WORD - lshift)) {
-				entropy[ENTROPY_WORD_INDEX(word_i+1)]  &=
+				pool->entropy[ENTROPY_WORD_INDEX(word_i+1)]  &=
 				(~0ULL << ((bits_to_discard) % BITS_PER_WORD));
 				bits_to_discard = 0;
 			} else {
@@ -204,7 +254,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 			 * there are still some unused valid entropy bits at the
 			 * upper end for future use.
 			 */
-				entropy[ENTROPY_WORD_INDEX(word_i+1)]  &=
+				pool->entropy[ENTROPY_WORD_INDEX(word_i+1)]  &=
 				(~0ULL << ((BITS_PER_WORD - lshift) % BITS_PER_WORD));
 				bits_to_discard -= (BITS_PER_WORD - lshift);
 		}
@@ -215,22 +265,47 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 
 	out[to_fill - 1] &= mask;
 
-	entropy_bit_index = (entropy_bit_index + nbits) % BITS_IN_POOL;
-	entropy_bit_size -= nbits;
+	pool->bit_index = (pool->bit_index + nbits) % BITS_IN_POOL;
+	pool->bit_size -= nbits;
+
+	return true;
+}
+
+/*
+ * Opportunistically fill the pool of this CPU and the reservoir from the
+ * entropy source, so that later requests do not have to wait for it. Nothing
+ * is done if another CPU is using the entropy source.
+ */
+void trng_entropy_pool_refill(void)
+{
+	trng_pool_t *pool = &trng_pools[plat_my_core_pos()];
+
+	if (!spin_trylock(&trng_pool_lock)) {
+		return;
+	}
+
+	while ((pool->bit_size + BITS_PER_WORD) <= BITS_IN_POOL) {
+		if (!trng_reservoir_take(&pool->entropy[ENTROPY_FREE_INDEX],
+					 true)) {
+			goto out;
+		}
+		pool->bit_size += BITS_PER_WORD;
+	}
+
+	while (trng_reservoir_words < PLAT_TRNG_RESERVOIR_WORDS) {
+		if (!plat_get_entropy(&trng_reservoir[trng_reservoir_words])) {
+			break;
+		}
+		trng_reservoir_words++;
+	}
 
 out:
 	spin_unlock(&trng_pool_lock);
-
-	return ret;
 }
 
 void trng_entropy_pool_setup(void)
 {
-	int i;
-
-	for (i = 0; i < WORDS_IN_POOL; i++) {
-		entropy[i] = 0;
-	}
-	entropy_bit_index = 0;
-	entropy_bit_size = 0;
+	zeromem(trng_pools, sizeof(trng_pools));
+	zeromem(trng_reservoir, sizeof(trng_reservoir));
+	trng_reservoir_words = 0U;
 }
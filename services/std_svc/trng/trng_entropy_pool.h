@@ -11,6 +11,7 @@
 #include <stdint.h>
 
 bool trng_pack_entropy(uint32_t nbits, uint64_t *out);
+void trng_entropy_pool_refill(void);
 void trng_entropy_pool_setup(void);
 
 #endif /* TRNG_ENTROPY_POOL_H */
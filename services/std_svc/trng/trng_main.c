@@ -9,6 +9,7 @@
 #include <stdint.h>
 
 #include <arch_features.h>
+#include <lib/el3_runtime/pubsub_events.h>
 #include <lib/smccc.h>
 #include <services/trng_svc.h>
 #include <smccc_helpers.h>
@@ -96,6 +97,20 @@ void trng_setup(void)
 	plat_entropy_setup();
 }
 
+#if TRNG_REFILL_ON_SUSPEND
+/*
+ * Refill the entropy pool of this CPU and the reservoir before the CPU powers
+ * down, so that later TRNG calls do not have to wait for the entropy source.
+ */
+static void *trng_suspend_refill(const void *arg)
+{
+	trng_entropy_pool_refill();
+	return (void *)0;
+}
+
+SUBSCRIBE_TO_EVENT(psci_suspend_pwrdown_start, trng_suspend_refill);
+#endif /* TRNG_REFILL_ON_SUSPEND */
+
 /* Predicate indicating that a function id is part of TRNG */
 bool is_trng_fid(uint32_t smc_fid)
 {
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * This file is never linked into an image. It is compiled to assembly with
+ * the flags of BL31 so that the layout of 'cpu_context_t' for the current
+ * build can be extracted from the output by context_report.py.
+ */
+
+#include <platform_def.h>
+
+#include <context.h>
+#include <lib/el3_runtime/cpu_data.h>
+
+#define REPORT(_name, _val)						\
+	__asm__ volatile("\n.ascii \"->" _name " %c0\"" : : "i" (_val))
+
+#define REPORT_BLOCK(_member)						\
+	REPORT(#_member, __builtin_offsetof(cpu_context_t, _member));	\
+	REPORT(#_member "_size",					\
+	       sizeof(((cpu_context_t *)0)->_member))
+
+void context_report(void);
+
+void context_report(void)
+{
+	REPORT("cache_line", CACHE_WRITEBACK_GRANULE);
+	REPORT("contexts_per_cpu", CPU_CONTEXT_NUM);
+	REPORT("core_count", PLATFORM_CORE_COUNT);
+	REPORT("cpu_context_t", sizeof(cpu_context_t));
+
+	REPORT_BLOCK(gpregs_ctx);
+	REPORT_BLOCK(el3state_ctx);
+#if DYNAMIC_WORKAROUND_CVE_2018_3639
+	REPORT_BLOCK(cve_2018_3639_ctx);
+#endif
+#if CTX_INCLUDE_PAUTH_REGS
+	REPORT_BLOCK(pauth_ctx);
+#endif
+	REPORT_BLOCK(el1_sysregs_ctx);
+#if CTX_INCLUDE_EL2_REGS
+	REPORT_BLOCK(el2_sysregs_ctx);
+#endif
+#if CTX_INCLUDE_FPREGS
+	REPORT_BLOCK(fpregs_ctx);
+#endif
+}
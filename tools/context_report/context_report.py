@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+"""Print the layout of cpu_context_t for a given build.
+
+Takes the assembly file produced by compiling context_report.c with the BL31
+flags of the build, which contains lines of the form "->name value", and
+prints the offset, size and cache lines of every block of the structure. The
+cache lines are counted from the start of the structure, as if it was aligned
+to a cache line.
+"""
+
+import re
+import sys
+
+REPORT_RE = re.compile(r'->(\w+)\s+[#$]?(-?\d+)')
+
+
+def parse(path):
+    values = {}
+    blocks = []
+    with open(path) as f:
+        for line in f:
+            match = REPORT_RE.search(line)
+            if match is None:
+                continue
+            name, value = match.group(1), int(match.group(2))
+            values[name] = value
+            if name.endswith('_ctx'):
+                blocks.append(name)
+    return values, blocks
+
+
+def main(path):
+    values, blocks = parse(path)
+    line = values['cache_line']
+    total = values['cpu_context_t']
+    lines = (total + line - 1) // line
+
+    print('cpu_context_t layout ({} byte cache lines)'.format(line))
+    print('  {:<20} {:>8} {:>6}  {}'.format('block', 'offset', 'size',
+                                           'cache lines'))
+    for block in blocks:
+        offset = values[block]
+        size = values[block + '_size']
+        first = offset // line
+        last = (offset + size - 1) // line
+        print('  {:<20} {:>#8x} {:>6}  {}-{}'.format(block, offset, size,
+                                                    first, last))
+
+    per_cpu = total * values['contexts_per_cpu']
+    print('  total: {} bytes, {} cache lines'.format(total, lines))
+    print('  per CPU: {} bytes ({} contexts)'.format(
+        per_cpu, values['contexts_per_cpu']))
+    print('  all CPUs: {} bytes ({} CPUs)'.format(
+        per_cpu * values['core_count'], values['core_count']))
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 2:
+        sys.exit('usage: {} <context_report.s>'.format(sys.argv[0]))
+    main(sys.argv[1])
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+"""Decode a raw copy of the BL31 EL3 trace buffer.
+
+The buffer is the one registered with the EL3_TRACE_SMC_SETUP SiP call, copied
+verbatim by the Non-secure world. It is laid out as follows, little-endian:
+
+  Header (64 bytes):
+    uint32_t magic           0x54334c45 ("EL3T")
+    uint16_t version         1
+    uint16_t num_cpus
+    uint32_t entries_per_cpu
+    uint32_t entry_size      32
+    uint64_t counter_freq    CNTFRQ_EL0 value, in Hz
+    uint64_t ring_offset     offset of the ring of CPU 0
+    uint64_t ring_stride     distance between consecutive rings
+
+  Ring, one per CPU:
+    uint64_t head            number of entries ever written, padded to 64 bytes
+    entry[entries_per_cpu]   entry for count n at index n % entries_per_cpu
+
+  Entry (32 bytes):
+    uint64_t timestamp       CNTPCT_EL0 value
+    uint16_t event
+    uint16_t cpu
+    uint32_t arg0
+    uint64_t arg1, arg2
+
+The rings of all CPUs are merged in timestamp order and printed one event per
+line.
+"""
+
+import argparse
+import struct
+import sys
+
+HEADER = struct.Struct("<IHHIIQQQ")
+ENTRY = struct.Struct("<QHHIQQ")
+RING_HDR_SIZE = 64
+MAGIC = 0x54334C45
+VERSION = 1
+
+EV_SMC_ENTRY = 1
+EV_SMC_EXIT = 2
+
+EVENTS = {
+    1: "SMC_ENTRY",
+    2: "SMC_EXIT",
+    3: "WORLD_SWITCH",
+    4: "PSCI_PWR_DOWN",
+    5: "PSCI_WARMBOOT",
+    6: "EHF_ACTIVATE",
+    7: "EHF_DEACTIVATE",
+    8: "INTR_ACK",
+}
+
+SECURITY_STATES = {0: "Secure", 1: "Non-secure", 2: "Realm"}
+
+
+def describe(event, arg0, arg1, arg2):
+    """Return a human readable description of the event arguments."""
+    if event == EV_SMC_ENTRY:
+        return "fid=0x%08x flags=0x%x x1=0x%x" % (arg0, arg1, arg2)
+    if event == EV_SMC_EXIT:
+        return "fid=0x%08x" % arg0
+    if event == 3:
+        return "to=%s" % SECURITY_STATES.get(arg0, str(arg0))
+    if event == 4:
+        return "pwrlvl=%d %s" % (arg0, "suspend" if arg1 else "off")
+    if event in (6, 7):
+        return "prio=0x%x prev_mask=0x%x" % (arg0, arg1)
+    if event == 8:
+        return "intid=%d" % (arg0 & 0xFFFFFF)
+    return ""
+
+
+def parse(data):
+    """Parse a buffer and return the counter frequency and entries."""
+    if len(data) < HEADER.size:
+        raise ValueError("file too short")
+
+    magic, version, num_cpus, entries, entry_size, freq, ring_offset, \
+        stride = HEADER.unpack_from(data, 0)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError("bad magic or unsupported version")
+    if entry_size != ENTRY.size or entries == 0:
+        raise ValueError("unsupported layout")
+    if len(data) < ring_offset + num_cpus * stride:
+        raise ValueError("truncated file")
+
+    result = []
+    for cpu in range(num_cpus):
+        ring = ring_offset + cpu * stride
+        head = struct.unpack_from("<Q", data, ring)[0]
+        first = max(0, head - entries)
+        for count in range(first, head):
+            offset = ring + RING_HDR_SIZE + (count % entries) * ENTRY.size
+            result.append(ENTRY.unpack_from(data, offset))
+
+    result.sort(key=lambda e: e[0])
+    return freq, result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("buffer", help="raw copy of the trace buffer")
+    parser.add_argument("--cpu", type=int, help="only print events of a CPU")
+    args = parser.parse_args()
+
+    with open(args.buffer, "rb") as buf:
+        try:
+            freq, entries = parse(buf.read())
+        except ValueError as err:
+            sys.exit("%s: %s" % (args.buffer, err))
+
+    if not entries:
+        return
+
+    ns_per_tick = 1e9 / freq if freq else 1.0
+    start = entries[0][0]
+    smc_entry_ts = {}
+
+    print("%14s %4s %-16s %s" % ("Time(ns)", "CPU", "Event", "Details"))
+    for ts, event, cpu, arg0, arg1, arg2 in entries:
+        details = describe(event, arg0, arg1, arg2)
+        if event == EV_SMC_ENTRY:
+            smc_entry_ts[cpu] = ts
+        elif event == EV_SMC_EXIT and cpu in smc_entry_ts:
+            details += " el3=%.0fns" % ((ts - smc_entry_ts.pop(cpu)) *
+                                        ns_per_tick)
+
+        if args.cpu is not None and cpu != args.cpu:
+            continue
+
+        print("%14.0f %4d %-16s %s" %
+              ((ts - start) * ns_per_tick, cpu,
+               EVENTS.get(event, "EVENT_%d" % event), details))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+"""Decode a dump of the BL31 SMC EL3 residency statistics.
+
+The dump is produced by a Non-secure agent which reads the statistics through
+the SMC_STATS_SMC_GET_INFO/GET_ENTRY/GET_HIST SiP calls and writes them to a
+file in the following little-endian format:
+
+  Header (32 bytes):
+    char     magic[8]        "SMCSTATS"
+    uint32_t version         1
+    uint32_t num_records
+    uint64_t counter_freq    CNTFRQ_EL0 value, in Hz
+    uint32_t hist_log2_width x4 of SMC_STATS_SMC_GET_INFO
+    uint32_t hist_buckets    x3 of SMC_STATS_SMC_GET_INFO
+
+  Record (88 bytes), one per used entry:
+    uint32_t cpu
+    uint32_t smc_fid
+    uint64_t count, total, min, max
+    uint32_t hist[12]        x1-x6 of SMC_STATS_SMC_GET_HIST
+
+Statistics are aggregated across CPUs and printed per SMC function ID.
+"""
+
+import argparse
+import struct
+import sys
+
+HEADER = struct.Struct("<8sIIQII")
+RECORD_PREFIX = struct.Struct("<IIQQQQ")
+MAGIC = b"SMCSTATS"
+VERSION = 1
+
+OENS = {
+    0: "Arm Arch",
+    1: "CPU",
+    2: "SiP",
+    3: "OEM",
+    4: "Std",
+    5: "Std Hyp",
+    6: "Vendor Hyp",
+}
+
+STD_FUNCS = {
+    0x00: "PSCI_VERSION",
+    0x01: "PSCI_CPU_SUSPEND",
+    0x02: "PSCI_CPU_OFF",
+    0x03: "PSCI_CPU_ON",
+    0x04: "PSCI_AFFINITY_INFO",
+    0x08: "PSCI_SYSTEM_OFF",
+    0x09: "PSCI_SYSTEM_RESET",
+    0x0A: "PSCI_FEATURES",
+    0x0E: "PSCI_SYSTEM_SUSPEND",
+    0x20: "SDEI_VERSION",
+    0x21: "SDEI_EVENT_REGISTER",
+    0x22: "SDEI_EVENT_ENABLE",
+    0x24: "SDEI_EVENT_CONTEXT",
+    0x25: "SDEI_EVENT_COMPLETE",
+    0x26: "SDEI_EVENT_COMPLETE_AND_RESUME",
+    0x2F: "SDEI_PE_MASK",
+    0x30: "SDEI_PE_UNMASK",
+    0x50: "TRNG_VERSION",
+    0x51: "TRNG_FEATURES",
+    0x52: "TRNG_GET_UUID",
+    0x53: "TRNG_RND",
+    0x63: "FFA_VERSION",
+    0x64: "FFA_FEATURES",
+    0x65: "FFA_RX_RELEASE",
+    0x66: "FFA_RXTX_MAP",
+    0x68: "FFA_PARTITION_INFO_GET",
+    0x69: "FFA_ID_GET",
+    0x6B: "FFA_MSG_WAIT",
+    0x6D: "FFA_RUN",
+    0x6F: "FFA_MSG_SEND_DIRECT_REQ",
+    0x70: "FFA_MSG_SEND_DIRECT_RESP",
+    0x73: "FFA_MEM_SHARE",
+    0x74: "FFA_MEM_RETRIEVE_REQ",
+    0x76: "FFA_MEM_RELINQUISH",
+    0x77: "FFA_MEM_RECLAIM",
+    0x7A: "FFA_MEM_FRAG_RX",
+    0x7B: "FFA_MEM_FRAG_TX",
+    0x86: "FFA_MSG_SEND2",
+}
+
+
+def fid_name(fid):
+    """Return a human readable name for an SMC function ID."""
+    oen = (fid >> 24) & 0x3F
+    func = fid & 0xFFFF
+    smc64 = "64" if fid & (1 << 30) else "32"
+
+    if oen == 4 and func in STD_FUNCS:
+        return "%s(SMC%s)" % (STD_FUNCS[func], smc64)
+
+    if oen in OENS:
+        owner = OENS[oen]
+    elif 0x30 <= oen <= 0x31:
+        owner = "Trusted App"
+    elif 0x32 <= oen <= 0x3F:
+        owner = "Trusted OS"
+    else:
+        owner = "OEN %d" % oen
+
+    call = "Fast" if fid & (1 << 31) else "Yield"
+    return "%s %s func 0x%x(SMC%s)" % (owner, call, func, smc64)
+
+
+def percentile(hist, fraction, log2_width):
+    """Upper bound, in ticks, of the bucket holding the given percentile."""
+    total = sum(hist)
+    if total == 0:
+        return 0
+
+    target = fraction * total
+    seen = 0
+    for bucket, count in enumerate(hist):
+        seen += count
+        if seen >= target:
+            return 1 << (log2_width * (bucket + 1))
+
+    return 1 << (log2_width * len(hist))
+
+
+def parse(data):
+    """Parse a dump and return the header fields and list of records."""
+    if len(data) < HEADER.size:
+        raise ValueError("file too short")
+
+    magic, version, num, freq, log2_width, buckets = \
+        HEADER.unpack_from(data, 0)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError("bad magic or unsupported version")
+
+    hist_fmt = struct.Struct("<%dI" % buckets)
+    rec_size = RECORD_PREFIX.size + hist_fmt.size
+    if len(data) < HEADER.size + num * rec_size:
+        raise ValueError("truncated file")
+
+    records = []
+    offset = HEADER.size
+    for _ in range(num):
+        cpu, fid, count, total, tmin, tmax = \
+            RECORD_PREFIX.unpack_from(data, offset)
+        hist = hist_fmt.unpack_from(data, offset + RECORD_PREFIX.size)
+        records.append((cpu, fid, count, total, tmin, tmax, list(hist)))
+        offset += rec_size
+
+    return freq, log2_width, records
+
+
+def aggregate(records, per_cpu):
+    """Merge records by function ID, and optionally by CPU."""
+    merged = {}
+    for cpu, fid, count, total, tmin, tmax, hist in records:
+        if count == 0:
+            continue
+
+        key = (cpu if per_cpu else None, fid)
+        if key not in merged:
+            merged[key] = [count, total, tmin, tmax, hist]
+            continue
+
+        entry = merged[key]
+        entry[0] += count
+        entry[1] += total
+        entry[2] = min(entry[2], tmin)
+        entry[3] = max(entry[3], tmax)
+        entry[4] = [a + b for a, b in zip(entry[4], hist)]
+
+    return merged
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("dump", help="binary statistics dump")
+    parser.add_argument("--per-cpu", action="store_true",
+                        help="do not merge statistics across CPUs")
+    parser.add_argument("--sort", choices=["total", "count", "max"],
+                        default="total", help="sort key (default: total)")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as dump:
+        try:
+            freq, log2_width, records = parse(dump.read())
+        except ValueError as err:
+            sys.exit("%s: %s" % (args.dump, err))
+
+    ns_per_tick = 1e9 / freq if freq else 1.0
+    merged = aggregate(records, args.per_cpu)
+    grand_total = sum(e[1] for e in merged.values()) or 1
+    sort_idx = {"count": 0, "total": 1, "max": 3}[args.sort]
+
+    print("%-4s %-48s %10s %10s %10s %10s %10s %10s %6s" %
+          ("CPU", "Function", "Count", "Min(ns)", "Avg(ns)", "Max(ns)",
+           "P50(ns)", "P99(ns)", "EL3%"))
+    for (cpu, fid), (count, total, tmin, tmax, hist) in sorted(
+            merged.items(), key=lambda kv: kv[1][sort_idx], reverse=True):
+        print("%-4s %-48s %10d %10.0f %10.0f %10.0f %10.0f %10.0f %6.1f" %
+              ("all" if cpu is None else str(cpu),
+               "0x%08x %s" % (fid, fid_name(fid)), count,
+               tmin * ns_per_tick, total * ns_per_tick / count,
+               tmax * ns_per_tick,
+               percentile(hist, 0.50, log2_width) * ns_per_tick,
+               percentile(hist, 0.99, log2_width) * ns_per_tick,
+               100.0 * total / grand_total))
+
+
+if __name__ == "__main__":
+    main()